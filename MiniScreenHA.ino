@@ -6,6 +6,13 @@
 #include "display_init.h"
 #include "mqtt_handler.h"
 #include "screen_manager.h"
+#include "lvgl_mem.h"
+#include "perf_monitor.h"
+#include "te_sync.h"
+#include "glyph_cache.h"
+#include "refresh_governor.h"
+#include "log_ring.h"
+#include "touch_input.h"
 
 // Define the arrays that are declared extern in config.h
 const char* SCREEN_NAMES[] = {
@@ -28,12 +35,16 @@ MQTTHandler mqttHandler;
 unsigned long lastWiFiReconnectAttempt = 0;
 unsigned long lastMQTTReconnectAttempt = 0;
 unsigned long lastStatusUpdate = 0;
+unsigned long lastDiagnostics = 0;
 bool isConnected = false;
 
+static const char *TAG = "main";
+
 // Note: LVGL locking is now handled internally by display_init.cpp
 
 void setup() {
     Serial.begin(115200);
+    logInit();
     delay(1000);
     
     Serial.println("ESP32-S3 Home Assistant Controller");
@@ -51,8 +62,11 @@ void setup() {
         }
     }
     
+    lvglMemTraceMark("display");
+    
     Serial.println("Initializing screens...");
     screenManager.init();
+    lvglMemTraceMark("screens");
     
     Serial.println("Connecting to WiFi...");
     connectWiFi();
@@ -62,7 +76,7 @@ void setup() {
     mqttClient.setServer(MQTT_SERVER, MQTT_PORT);
     
     connectMQTT();
-    screenManager.showScreen(SCREEN_LIGHT);
+    screenManager.requestScreen(SCREEN_LIGHT);
     
     Serial.println("Setup completed!");
     digitalWrite(STATUS_LED_PIN, HIGH);
@@ -102,6 +116,10 @@ void loop() {
                 mqttHandler.subscribeToTopics();
                 mqttHandler.requestStatusUpdate();
             }
+            
+            // Commands from the UI, on this task so PubSubClient is never
+            // used from two tasks
+            mqttHandler.sendPendingCommands();
         }
     }
     
@@ -110,6 +128,11 @@ void loop() {
         lastStatusUpdate = currentTime;
     }
     
+    if (isConnected && currentTime - lastDiagnostics >= DIAGNOSTICS_INTERVAL) {
+        sendDiagnostics();
+        lastDiagnostics = currentTime;
+    }
+    
     screenManager.update();
     delay(10); // Increased delay since LVGL now runs in its own task
 }
@@ -149,16 +172,15 @@ void connectMQTT() {
     }
     
     if (connected) {
-        Serial.println("MQTT connected!");
+        LOG_I(TAG, "MQTT connected!");
         mqttClient.publish(DEVICE_STATUS_TOPIC, "online", true);
     } else {
-        Serial.print("MQTT failed! Error: ");
-        Serial.println(mqttClient.state());
+        LOG_W(TAG, "MQTT failed! Error: %d", mqttClient.state());
     }
 }
 
 void sendDeviceStatus() {
-    StaticJsonDocument<200> doc;
+    StaticJsonDocument<384> doc;
     
     doc["device"] = DEVICE_NAME;
     doc["status"] = "online";
@@ -167,8 +189,75 @@ void sendDeviceStatus() {
     doc["uptime"] = millis() / 1000;
     doc["current_screen"] = SCREEN_NAMES[screenManager.getCurrentScreen()];
     
-    String payload;
-    serializeJson(doc, payload);
+    const LvglMemStats lvglMem = getLvglMemStats();
+    doc["lvgl_free"] = lvglMem.freeBytes;
+    doc["lvgl_min_free"] = lvglMem.minFreeBytes;
+    doc["lvgl_largest_free"] = lvglMem.largestFreeBytes;
+    doc["lvgl_frag_pct"] = lvglMem.fragPct;
+    
+    publishJson(DEVICE_STATUS_TOPIC, doc, true);
+}
+
+// publish() builds the whole packet in PubSubClient's buffer and fails
+// once topic and payload outgrow it; that buffer is sized for receiving
+// (mqtt_handler.cpp) and may shrink when PSRAM is missing. beginPublish()
+// writes the header and streams the payload after it, so the buffer size
+// does not matter. The payload is serialized first, into a buffer sized
+// with measureJson(), so it leaves in one write.
+bool publishJson(const char* topic, const JsonDocument& doc, bool retained) {
+    const size_t length = measureJson(doc);
+    char* payload = (char*)malloc(length + 1);
+    if (!payload) {
+        LOG_W(TAG, "%s: no memory for a %u byte document", topic, (unsigned)length);
+        return false;
+    }
+    serializeJson(doc, payload, length + 1);
     
-    mqttClient.publish(DEVICE_STATUS_TOPIC, payload.c_str(), true);
-}
\ No newline at end of file
+    const bool ok = mqttClient.beginPublish(topic, length, retained) &&
+                    mqttClient.write((const uint8_t*)payload, length) == length &&
+                    mqttClient.endPublish();
+    free(payload);
+    if (!ok) {
+        LOG_W(TAG, "Publish to %s failed", topic);
+    }
+    return ok;
+}
+
+// Render health for the fleet. About 420 bytes of JSON, up to 590 once
+// the counters reach ten digits, so it goes out through publishJson().
+void sendDiagnostics() {
+    StaticJsonDocument<512> doc;
+    
+    const PerfMonitorStats perf = getPerfMonitorStats();
+    doc["fps"] = perf.fps;
+    doc["frame_ms"] = perf.frameMs;
+    doc["frame_max_ms"] = perf.frameMaxMs;
+    doc["render_us"] = perf.renderUs;
+    doc["flush_us"] = perf.flushUs;
+    doc["px_frame"] = perf.pxPerFrame;
+    doc["px_s"] = perf.pxPerSec;
+    doc["cpu_pct"] = perf.cpuPct;
+    doc["lvgl_free"] = perf.lvglFreeBytes;
+    doc["lvgl_used_pct"] = perf.lvglUsedPct;
+    doc["lvgl_frag_pct"] = perf.lvglFragPct;
+    doc["touch_ms"] = perf.touchLatencyMs;
+    doc["touch_max_ms"] = perf.touchLatencyMaxMs;
+    const TouchInputStats touch = getTouchInputStats();
+    doc["touch_cb_us"] = touch.readCbUs;
+    doc["touch_cb_max_us"] = touch.readCbMaxUs;
+    
+    doc["mode"] = getRefreshGovernorStats().mode == REFRESH_MODE_ACTIVE ? "active" : "data";
+    doc["te_missed"] = getTeSyncStats().missedDeadlines;
+    const GlyphCacheStats glyphs = getGlyphCacheStats();
+    doc["glyph_hits"] = glyphs.hits;
+    doc["glyph_misses"] = glyphs.misses;
+    const MqttRxStats mqtt = mqttHandler.getRxStats();
+    doc["mqtt_dropped"] = mqtt.oversized;
+    doc["mqtt_max_payload"] = mqtt.largestPayload;
+    doc["mqtt_buf"] = mqtt.bufferSize;
+    doc["mqtt_stack_free"] = mqtt.stackFreeMin;
+    doc["log_dropped"] = getLogStats().dropped;
+    doc["uptime"] = millis() / 1000;
+    
+    publishJson(DIAGNOSTICS_TOPIC, doc, false);
+}
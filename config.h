@@ -25,11 +25,14 @@
 #define HVAC_STATE_TOPIC "homeassistant/climate/" HVAC_ENTITY_ID "/state"
 #define HVAC_COMMAND_TOPIC "homeassistant/climate/" HVAC_ENTITY_ID "/set"
 #define DEVICE_STATUS_TOPIC "homeassistant/sensor/" DEVICE_NAME "/state"
+#define DIAGNOSTICS_TOPIC "homeassistant/sensor/" DEVICE_NAME "/diagnostics"
+#define DIAGNOSTICS_COMMAND_TOPIC DIAGNOSTICS_TOPIC "/set"    // "ON"/"OFF" shows or hides the perf overlay
 
 // Display Configuration - Updated for ESP32-S3-AMOLED-1.91
 #define SCREEN_WIDTH 536
 #define SCREEN_HEIGHT 240
 #define SCREEN_ROTATION 1
+#define DISPLAY_ROTATION LV_DISP_ROT_NONE   // LV_DISP_ROT_90 or _270 for portrait units, done in software
 #define EXAMPLE_USE_TOUCH 1
 
 // Hardware Pins - Corrected for ESP32-S3-AMOLED-1.91
@@ -40,6 +43,7 @@
 #define EXAMPLE_PIN_NUM_LCD_DATA2         48
 #define EXAMPLE_PIN_NUM_LCD_DATA3         5
 #define EXAMPLE_PIN_NUM_LCD_RST           17
+#define EXAMPLE_PIN_NUM_LCD_TE            (-1)  // tearing effect output, -1 if not wired
 #define EXAMPLE_PIN_NUM_BK_LIGHT          (-1)
 
 #define EXAMPLE_PIN_NUM_TOUCH_SCL         39
@@ -62,6 +66,28 @@ extern const char* SCREEN_NAMES[];
 #define MQTT_RECONNECT_INTERVAL 5000
 #define WIFI_RECONNECT_INTERVAL 10000
 #define STATUS_UPDATE_INTERVAL 30000
+#define DIAGNOSTICS_INTERVAL 10000
+// Commands from the UI go out at most this often; a slider drag sends its
+// newest value each time
+#define MQTT_COMMAND_INTERVAL 100
+
+// Incoming MQTT payloads are parsed in place in PubSubClient's buffer;
+// anything longer than this is dropped unparsed
+#define MQTT_MAX_PAYLOAD_BYTES 8192
+// PubSubClient packet buffer, header and topic included, allocated once
+// at boot. Past CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL (4 KB) the heap serves
+// it from PSRAM. Without PSRAM the small size keeps internal RAM free.
+#define MQTT_BUFFER_SIZE (MQTT_MAX_PAYLOAD_BYTES + 512)
+#define MQTT_BUFFER_SIZE_INTERNAL 1536
+
+// State updates from the network side wait here until the LVGL task picks
+// them up (power of two)
+#define UI_QUEUE_DEPTH 16
+
+// Idle view: after this long without touch, a screen that declares a live
+// region only keeps that band of the panel lit (0 disables it)
+#define DISPLAY_IDLE_VIEW_TIMEOUT_MS 60000
+#define DISPLAY_IDLE_USE_IDLE_MODE   1   // also drop to the panel's 8 color idle mode
 
 // Control Limits
 #define MIN_BRIGHTNESS 1
@@ -78,15 +104,88 @@ extern const char* HVAC_MODES[];
 // Display - Using proper SH8601 configuration
 #define LCD_HOST    SPI2_HOST
 #define TOUCH_HOST  I2C_NUM_0
-#define LCD_BIT_PER_PIXEL       16
+#define LCD_BIT_PER_PIXEL       16  // wire format: 16 (RGB565), 18 (RGB666) or 24 (RGB888)
+#define LCD_BYTES_PER_PIXEL     ((LCD_BIT_PER_PIXEL + 7) / 8)
+#define LCD_SWAP_RGB565         0   // send RGB565 high byte first (LVGL renders with LV_COLOR_16_SWAP 0)
+#define EXAMPLE_LCD_PCLK_HZ     (40 * 1000 * 1000)
+// Find the fastest QSPI clock this unit handles once, keep it in NVS
+#define LCD_PCLK_AUTOTUNE       1
+#define LCD_PCLK_TUNE_FORCE     0   // ignore the stored rate and calibrate again
+#define LCD_PCLK_TUNE_ROUNDS    20  // readback checks per rate
+#define LCD_PCLK_TUNE_RATES     {40000000, 48000000, 60000000, 80000000}
 #define EXAMPLE_LVGL_BUF_HEIGHT        (SCREEN_HEIGHT/4)
 #define EXAMPLE_LVGL_TICK_PERIOD_MS    2
 #define EXAMPLE_LVGL_TASK_MAX_DELAY_MS 500
 #define EXAMPLE_LVGL_TASK_MIN_DELAY_MS 1
 #define EXAMPLE_LVGL_TASK_STACK_SIZE   (4 * 1024)
 #define EXAMPLE_LVGL_TASK_PRIORITY     2
+#define EXAMPLE_LVGL_TASK_CORE         1
+// LVGL heap (LV_MEM_SIZE in lv_conf.h) in PSRAM, leaving internal RAM to WiFi
+// and lwIP. Falls back to internal RAM when PSRAM is not available.
+#define LVGL_MEM_IN_PSRAM              1
+#define LVGL_MEM_SAMPLE_MS             1000    // how often the heap statistics are refreshed
+
+// Keep a copy of the full frame in PSRAM and only send tiles that changed
+#define DISPLAY_USE_SHADOW_FB          1
+#define DISPLAY_SHADOW_TILE_SIZE       16
+// Collect the dirty tiles of a whole refresh cycle and send them together
+#define DISPLAY_COALESCE_FLUSH         1
+// Start each refresh cycle on a tearing effect edge and pace LVGL to the
+// panel's refresh rate. Without a TE pin, a timer can stand in for it.
+#define DISPLAY_TE_SIMULATE            0
+#define DISPLAY_TE_SIM_PERIOD_US       16667
+// Refresh governor: LVGL refreshes at the panel rate while a finger is down
+// or an animation runs, and at the slow data rate otherwise. With nothing
+// invalidated LVGL pauses its refresh timer by itself.
+#define REFRESH_ACTIVE_HOLD_MS         500     // full rate lingers this long after the last touch or animation
+#define REFRESH_DATA_PERIOD_MS         100     // refresh and UI queue period when nobody touches the panel
+#define REFRESH_IDLE_INDEV_MS          50      // touch read period when idle, a new press wakes LVGL at once
+// Render into a third draw buffer while a flush task on the other core
+// feeds finished areas to the panel
+#define DISPLAY_PIPELINE               1
+#define DISPLAY_FLUSH_TASK_CORE        0
+#define DISPLAY_FLUSH_TASK_PRIORITY    3
+#define DISPLAY_FLUSH_TASK_STACK_SIZE  (4 * 1024)
+// Decoded glyphs of RLE compressed fonts kept in internal RAM, least
+// recently used goes first. Fewer than the 12 glyphs of montserrat_96:
+// a screen shows the two step buttons and a temperature's digits, the
+// target sprite renders its digits once at init.
+#define GLYPH_CACHE_ENTRIES            6
+// Render performance (frame time, invalidated pixels, LVGL heap, touch
+// latency) over windows of PERF_MONITOR_PERIOD_MS, published to
+// DIAGNOSTICS_TOPIC and optionally drawn over the UI
+#define PERF_MONITOR_PERIOD_MS         1000
+#define PERF_OVERLAY                   0       // show the overlay from boot
+
+// Log lines go through a ring that a low priority task drains to Serial.
+// Levels above LOG_LEVEL are compiled out (0 none, 1 error, 2 warn, 3 info, 4 debug).
+#define LOG_LEVEL                      3
+#define LOG_RING_SLOTS                 32      // power of two
+#define LOG_LINE_BYTES                 120     // longer lines are cut
+#define LOG_DRAIN_MS                   20
+#define LOG_TASK_CORE                  0
+#define LOG_TASK_PRIORITY              1
+#define LOG_TASK_STACK_SIZE            (3 * 1024)
 
 #define I2C_ADDR_FT3168 0x38
+#define TOUCH_I2C_FREQ_HZ              (300 * 1000)
+// Read the touch controller on its own task instead of inside LVGL's indev read
+#define TOUCH_INPUT_TASK               1
+#define TOUCH_TASK_CORE                0
+#define TOUCH_TASK_PRIORITY            4
+#define TOUCH_TASK_STACK_SIZE          (3 * 1024)
+// Polling without an INT pin: fast while touched, slow when left alone
+#define TOUCH_POLL_ACTIVE_MS           10
+#define TOUCH_POLL_IDLE_MS             80
+#define TOUCH_IDLE_AFTER_MS            1000
+// Swipes between screens: a swipe is recognized once the travel projected
+// GESTURE_PREDICT_MS ahead reaches GESTURE_INTENT_PX at a minimum speed
+#define GESTURE_SLOP_PX                6
+#define GESTURE_INTENT_PX              24
+#define GESTURE_INTENT_MIN_SPEED       200     // px/s
+#define GESTURE_PREDICT_MS             50
+#define GESTURE_FLING_MS               150     // how far the release velocity carries a screen
+#define GESTURE_PINCH_PERCENT          25      // change in finger distance that makes a pinch
 
 // Colors - Fixed hex values
 #define COLOR_PRIMARY   0x2196F3
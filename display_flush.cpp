@@ -0,0 +1,376 @@
+#include "display_flush.h"
+#include <Arduino.h>
+#include <atomic>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "log_ring.h"
+#include "esp_lcd_sh8601.h"
+#include "pixel_convert.h"
+#include "te_sync.h"
+#include "display_pipeline.h"
+
+static const char *TAG = "display_flush";
+
+#define TILE_SIZE   DISPLAY_SHADOW_TILE_SIZE
+#define TILE_COLS   ((SCREEN_WIDTH + TILE_SIZE - 1) / TILE_SIZE)
+#define TILE_ROWS   ((SCREEN_HEIGHT + TILE_SIZE - 1) / TILE_SIZE)
+#define TILE_COUNT  (TILE_COLS * TILE_ROWS)
+#define STAGING_PIXELS      (SCREEN_WIDTH * EXAMPLE_LVGL_BUF_HEIGHT)
+#define STAGING_HALF_PIXELS (STAGING_PIXELS / 2)
+
+// A tile row holds at most TILE_COLS / 2 separate runs of dirty tiles
+#define MAX_RECTS   (TILE_ROWS * (TILE_COLS / 2 + 1))
+
+// Only the two staging halves can be in flight, keep a few spare slots
+#define TRANS_LOG_SIZE 8
+
+// Initial cost model guesses, refined from measurements at runtime
+#define DEFAULT_WINDOW_OVERHEAD_NS  20000
+#define DEFAULT_TRANS_OVERHEAD_NS   10000
+#define MAX_OVERHEAD_SAMPLE_NS      1000000
+
+struct FlushRect {
+    int x1, y1, x2, y2;
+};
+
+struct TransRecord {
+    uint32_t bytes;
+    int64_t submitUs;
+};
+
+static esp_lcd_panel_handle_t flushPanel = NULL;
+static lv_color_t *shadowFb = NULL;     // full frame, PSRAM
+static uint8_t *stagingBuf = NULL;      // two halves in wire format, used in turn, DMA SRAM
+static uint8_t tileValid[(TILE_COUNT + 7) / 8];     // shadow matches the panel
+static uint8_t cycleDirty[(TILE_COUNT + 7) / 8];    // changed in the current refresh cycle
+static FlushRect rects[MAX_RECTS];
+static DisplayFlushStats stats;
+
+// Rows the panel currently shows; anything rendered outside is dropped
+static int bandY1 = 0;
+static int bandY2 = SCREEN_HEIGHT - 1;
+
+// Completion tracking. The submitter holds one reference to pendingRefs
+// while it queues transfers, so whichever side drops the last reference
+// reports the flush as ready.
+static std::atomic<int> pendingRefs(0);
+static std::atomic<uint32_t> submittedSeq(0);
+static std::atomic<uint32_t> completedSeq(0);
+static TransRecord transLog[TRANS_LOG_SIZE];
+static uint32_t halfSeq[2];
+static int nextHalf = 0;
+static int64_t lastCompletionUs = 0;
+static SemaphoreHandle_t stagingSem = NULL;
+
+// Cost model: fixed cost of a window (CASET/RASET, measured on an idle
+// bus) plus fixed cost of a RAMWR transaction (measured from completions)
+// plus wire time per byte derived from the pixel clock
+static uint32_t nsPerByte = 0;
+static int32_t windowOverheadNs = DEFAULT_WINDOW_OVERHEAD_NS;
+static std::atomic<int32_t> transOverheadNs(DEFAULT_TRANS_OVERHEAD_NS);
+
+static inline bool testBit(const uint8_t *map, int idx) {
+    return map[idx >> 3] & (1 << (idx & 7));
+}
+
+static inline void setBit(uint8_t *map, int idx) {
+    map[idx >> 3] |= (1 << (idx & 7));
+}
+
+bool displayFlushInit(esp_lcd_panel_handle_t panel, uint32_t pclk_hz) {
+    flushPanel = panel;
+    // Quad SPI moves 4 bits per clock, two clocks per byte
+    nsPerByte = 2000000000UL / pclk_hz;
+
+#if DISPLAY_USE_SHADOW_FB
+    shadowFb = (lv_color_t*)heap_caps_malloc(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+    if (!shadowFb) {
+        LOG_W(TAG, "Shadow framebuffer allocation failed, flushing without diffing");
+        return false;
+    }
+
+    stagingBuf = (uint8_t*)heap_caps_malloc(STAGING_PIXELS * LCD_BYTES_PER_PIXEL, MALLOC_CAP_DMA);
+    stagingSem = xSemaphoreCreateBinary();
+    if (!stagingBuf || !stagingSem) {
+        LOG_W(TAG, "Flush staging buffer allocation failed, flushing without diffing");
+        heap_caps_free(stagingBuf);
+        heap_caps_free(shadowFb);
+        stagingBuf = NULL;
+        shadowFb = NULL;
+        return false;
+    }
+
+    // Panel RAM is undefined after reset; every tile goes out on first use
+    memset(shadowFb, 0, SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(lv_color_t));
+    displayFlushInvalidateShadow();
+    LOG_I(TAG, "Shadow framebuffer enabled, %dx%d tiles", TILE_COLS, TILE_ROWS);
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool displayFlushShadowEnabled() {
+    return shadowFb != NULL;
+}
+
+void displayFlushInvalidateShadow() {
+    memset(tileValid, 0, sizeof(tileValid));
+}
+
+void displayFlushSetBand(int y1, int y2) {
+    bandY1 = y1;
+    bandY2 = y2;
+}
+
+// Compares one tile of the rendered area with the shadow frame and
+// copies it over if it differs. Returns true if the pixels changed.
+static bool diffTile(const lv_color_t *color_map, const lv_area_t *area, int x1, int y1, int x2, int y2) {
+    const int areaWidth = area->x2 - area->x1 + 1;
+    const size_t rowBytes = (x2 - x1 + 1) * sizeof(lv_color_t);
+    bool changed = false;
+
+    for (int y = y1; y <= y2; y++) {
+        const lv_color_t *src = color_map + (y - area->y1) * areaWidth + (x1 - area->x1);
+        lv_color_t *dst = shadowFb + y * SCREEN_WIDTH + x1;
+        if (memcmp(src, dst, rowBytes) != 0) {
+            changed = true;
+            memcpy(dst, src, rowBytes);
+        }
+    }
+    return changed;
+}
+
+static void diffArea(const lv_area_t *area, const lv_color_t *color_map) {
+    // Rows outside the band stay out of the shadow too, so they still
+    // differ from it once the whole panel is shown again
+    const int rowStart = LV_MAX(area->y1, bandY1);
+    const int rowEnd = LV_MIN(area->y2, bandY2);
+
+    for (int ty = rowStart / TILE_SIZE; rowStart <= rowEnd && ty <= rowEnd / TILE_SIZE; ty++) {
+        const int y1 = LV_MAX(rowStart, ty * TILE_SIZE);
+        const int y2 = LV_MIN(rowEnd, ty * TILE_SIZE + TILE_SIZE - 1);
+
+        for (int tx = area->x1 / TILE_SIZE; tx <= area->x2 / TILE_SIZE; tx++) {
+            const int x1 = LV_MAX(area->x1, tx * TILE_SIZE);
+            const int x2 = LV_MIN(area->x2, tx * TILE_SIZE + TILE_SIZE - 1);
+            const int idx = ty * TILE_COLS + tx;
+
+            if (diffTile(color_map, area, x1, y1, x2, y2) || !testBit(tileValid, idx)) {
+                setBit(cycleDirty, idx);
+                stats.tilesSent++;
+            } else {
+                stats.tilesSkipped++;
+            }
+        }
+    }
+}
+
+// Turns the dirty tile map into rectangles (in tile units): horizontal
+// runs per tile row, stacked with an identical run in the row above.
+static int buildRects() {
+    int count = 0;
+
+    for (int ty = 0; ty < TILE_ROWS; ty++) {
+        const int rowStart = count;
+        int tx = 0;
+        while (tx < TILE_COLS) {
+            if (!testBit(cycleDirty, ty * TILE_COLS + tx)) {
+                tx++;
+                continue;
+            }
+            const int runStart = tx;
+            while (tx < TILE_COLS && testBit(cycleDirty, ty * TILE_COLS + tx)) {
+                tx++;
+            }
+            const int runEnd = tx - 1;
+
+            bool stacked = false;
+            for (int i = 0; i < rowStart; i++) {
+                if (rects[i].x1 == runStart && rects[i].x2 == runEnd && rects[i].y2 == ty - 1) {
+                    rects[i].y2 = ty;
+                    stacked = true;
+                    break;
+                }
+            }
+            if (!stacked) {
+                rects[count++] = {runStart, ty, runEnd, ty};
+            }
+        }
+    }
+
+    memset(cycleDirty, 0, sizeof(cycleDirty));
+    return count;
+}
+
+static inline uint32_t rectOverheadNs() {
+    return windowOverheadNs + transOverheadNs.load();
+}
+
+static inline uint32_t rectCostNs(const FlushRect &r) {
+    const uint32_t bytes = (r.x2 - r.x1 + 1) * (r.y2 - r.y1 + 1) * LCD_BYTES_PER_PIXEL;
+    return rectOverheadNs() + bytes * nsPerByte;
+}
+
+// Converts tile rects to pixels and merges neighbours into their bounding
+// rectangle whenever one transaction is cheaper than two. Rects arrive in
+// raster order, so a single pass catches the merges that matter.
+static int mergeRects(int count) {
+    int out = 0;
+    FlushRect acc;
+
+    for (int i = 0; i < count; i++) {
+        FlushRect r = {
+            rects[i].x1 * TILE_SIZE,
+            rects[i].y1 * TILE_SIZE,
+            LV_MIN(rects[i].x2 * TILE_SIZE + TILE_SIZE - 1, SCREEN_WIDTH - 1),
+            LV_MIN(rects[i].y2 * TILE_SIZE + TILE_SIZE - 1, SCREEN_HEIGHT - 1),
+        };
+        if (i == 0) {
+            acc = r;
+            continue;
+        }
+
+        const FlushRect box = {
+            LV_MIN(acc.x1, r.x1), LV_MIN(acc.y1, r.y1),
+            LV_MAX(acc.x2, r.x2), LV_MAX(acc.y2, r.y2),
+        };
+        if (rectCostNs(box) <= rectCostNs(acc) + rectCostNs(r)) {
+            acc = box;
+            stats.rectsMerged++;
+        } else {
+            rects[out++] = acc;
+            acc = r;
+        }
+    }
+    if (count > 0) {
+        rects[out++] = acc;
+    }
+    return out;
+}
+
+static void waitForTransfer(uint32_t seq) {
+    while ((int32_t)(completedSeq.load() - seq) < 0) {
+        xSemaphoreTake(stagingSem, pdMS_TO_TICKS(10));
+    }
+}
+
+// Streams one rectangle from the shadow frame through the staging halves,
+// converting to the wire pixel format on the way. The first chunk starts
+// with RAMWR, the rest continue with RAMWRC so a large rectangle costs a
+// single window setup.
+static void sendRect(const FlushRect &r) {
+    const int w = r.x2 - r.x1 + 1;
+    const int rowsPerChunk = STAGING_HALF_PIXELS / w;
+    const bool busIdle = (completedSeq.load() == submittedSeq.load());
+
+    const int64_t windowStart = esp_timer_get_time();
+    esp_lcd_sh8601_set_window(flushPanel, r.x1, r.y1, r.x2 + 1, r.y2 + 1);
+    if (busIdle) {
+        int32_t sample = (int32_t)LV_MIN((esp_timer_get_time() - windowStart) * 1000, (int64_t)MAX_OVERHEAD_SAMPLE_NS);
+        windowOverheadNs += (sample - windowOverheadNs) / 8;
+    }
+
+    bool cont = false;
+    for (int y = r.y1; y <= r.y2; y += rowsPerChunk) {
+        const int rows = LV_MIN(rowsPerChunk, r.y2 - y + 1);
+        uint8_t *half = stagingBuf + nextHalf * STAGING_HALF_PIXELS * LCD_BYTES_PER_PIXEL;
+        waitForTransfer(halfSeq[nextHalf]);
+
+        uint8_t *dst = half;
+        for (int row = y; row < y + rows; row++) {
+            dst += pixel_to_wire(dst, (const uint16_t*)(shadowFb + row * SCREEN_WIDTH + r.x1), w);
+        }
+
+        const uint32_t bytes = dst - half;
+        const uint32_t seq = submittedSeq.load() + 1;
+        transLog[seq % TRANS_LOG_SIZE] = {bytes, esp_timer_get_time()};
+        halfSeq[nextHalf] = seq;
+        pendingRefs.fetch_add(1);
+        submittedSeq.store(seq);
+        esp_lcd_sh8601_write_pixels(flushPanel, half, bytes, cont);
+
+        cont = true;
+        nextHalf ^= 1;
+        stats.bytesSent += bytes;
+    }
+    stats.transactions++;
+
+    for (int ty = r.y1 / TILE_SIZE; ty <= r.y2 / TILE_SIZE; ty++) {
+        for (int tx = r.x1 / TILE_SIZE; tx <= r.x2 / TILE_SIZE; tx++) {
+            setBit(tileValid, ty * TILE_COLS + tx);
+        }
+    }
+}
+
+static void submitCycle(lv_disp_drv_t *drv) {
+    const int count = mergeRects(buildRects());
+    if (count == 0) {
+        displayFlushReady(drv);
+        return;
+    }
+
+    // Start writing right behind the panel's scan-out so it never reads
+    // a half written frame
+    teSyncWaitForEdge();
+
+    pendingRefs.store(1);
+    for (int i = 0; i < count; i++) {
+        sendRect(rects[i]);
+    }
+    if (pendingRefs.fetch_sub(1) == 1) {
+        teSyncFrameDone();
+        displayFlushReady(drv);
+    }
+}
+
+void displayFlushShadowed(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    diffArea(area, color_map);
+
+#if DISPLAY_COALESCE_FLUSH
+    // The pixels now live in the shadow frame, so LVGL can reuse the draw
+    // buffer right away; everything goes out after the last area
+    if (!displayFlushIsLast(drv)) {
+        displayFlushReady(drv);
+        return;
+    }
+#endif
+    submitCycle(drv);
+}
+
+bool displayFlushTransDone(bool *taskWoken) {
+    const int64_t now = esp_timer_get_time();
+    const uint32_t seq = completedSeq.load() + 1;
+    const TransRecord &rec = transLog[seq % TRANS_LOG_SIZE];
+
+    // Transfers complete in order; one that was queued behind another
+    // only starts being serviced once its predecessor is done
+    const int64_t start = rec.submitUs > lastCompletionUs ? rec.submitUs : lastCompletionUs;
+    const int64_t sample = (now - start) * 1000 - (int64_t)rec.bytes * nsPerByte;
+    if (sample > 0 && sample < MAX_OVERHEAD_SAMPLE_NS) {
+        int32_t overhead = transOverheadNs.load();
+        transOverheadNs.store(overhead + ((int32_t)sample - overhead) / 8);
+    }
+    lastCompletionUs = now;
+    completedSeq.store(seq);
+
+    BaseType_t highPriorityTaskWoken = pdFALSE;
+    xSemaphoreGiveFromISR(stagingSem, &highPriorityTaskWoken);
+    *taskWoken = (highPriorityTaskWoken == pdTRUE);
+
+    if (pendingRefs.fetch_sub(1) != 1) {
+        return false;
+    }
+    teSyncFrameDone();
+    return true;
+}
+
+DisplayFlushStats getDisplayFlushStats() {
+    DisplayFlushStats snapshot = stats;
+    snapshot.cmdOverheadNs = rectOverheadNs();
+    snapshot.nsPerByte = nsPerByte;
+    return snapshot;
+}
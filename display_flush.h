@@ -0,0 +1,46 @@
+#ifndef DISPLAY_FLUSH_H
+#define DISPLAY_FLUSH_H
+
+#include <lvgl.h>
+#include "esp_lcd_panel_ops.h"
+#include "config.h"
+
+// Counters for the shadow framebuffer flush path
+struct DisplayFlushStats {
+    uint32_t tilesSent = 0;
+    uint32_t tilesSkipped = 0;
+    uint32_t transactions = 0;      // windows (CASET/RASET/RAMWR) sent
+    uint32_t rectsMerged = 0;       // rects folded into a bounding rectangle
+    uint32_t bytesSent = 0;
+    uint32_t cmdOverheadNs = 0;     // cost model: fixed cost per window
+    uint32_t nsPerByte = 0;         // cost model: wire time per byte
+};
+
+// Allocates the PSRAM shadow frame and the DMA staging buffer.
+// Returns false if the shadow mode could not be enabled; the caller
+// should then flush areas straight to the panel.
+bool displayFlushInit(esp_lcd_panel_handle_t panel, uint32_t pclk_hz);
+bool displayFlushShadowEnabled();
+
+// Diffs the rendered area against the shadow frame and sends only the
+// tiles that changed. With DISPLAY_COALESCE_FLUSH the dirty tiles of a
+// whole refresh cycle are collected and sent after its last area, merged
+// into bounding rectangles where the cost model says it is cheaper.
+// Calls displayFlushReady() itself if nothing needs to go out over QSPI.
+void displayFlushShadowed(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+
+// Called from the color transfer done ISR. Returns true once the last
+// outstanding transfer of the current flush has completed.
+bool displayFlushTransDone(bool *taskWoken);
+
+// Forces the next flush of every tile to go out (e.g. after rotation)
+void displayFlushInvalidateShadow();
+
+// Restricts flushing to rows y1..y2 (inclusive) while the panel is in
+// partial display mode. Call it where the flush runs, through
+// displayPipelineRunCmd().
+void displayFlushSetBand(int y1, int y2);
+
+DisplayFlushStats getDisplayFlushStats();
+
+#endif
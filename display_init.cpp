@@ -4,31 +4,58 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
-#include "driver/i2c.h"
 #include "driver/spi_master.h"
 #include "esp_timer.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_vendor.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_err.h"
-#include "esp_log.h"
+#include "log_ring.h"
 #include "esp_lcd_sh8601.h"
+#include "display_flush.h"
+#include "pixel_convert.h"
+#include "te_sync.h"
+#include "display_pipeline.h"
+#include "display_rotate.h"
+#include "lcd_clock.h"
+#include "touch_input.h"
+#include "gesture.h"
+#include "lvgl_mem.h"
+#include "refresh_governor.h"
+#include "perf_monitor.h"
 
 static const char *TAG = "display_init";
 static SemaphoreHandle_t lvgl_mux = NULL;
 static esp_lcd_panel_handle_t panel_handle = NULL;
+// Rows the panel shows; owned by whichever task runs the flush paths
+static int active_band_y1 = 0;
+static int active_band_y2 = SCREEN_HEIGHT - 1;
+static bool band_requested = false;     // LVGL task side
+static bool te_frame_open = false;
 
 #if EXAMPLE_USE_TOUCH
 static lv_indev_t *touch_indev;
 #endif
 
+#if LCD_BIT_PER_PIXEL == 24
+#define LCD_COLMOD 0x77
+#elif LCD_BIT_PER_PIXEL == 18
+#define LCD_COLMOD 0x66
+#else
+#define LCD_COLMOD 0x55
+#endif
+
 // LCD initialization commands for SH8601
 static const sh8601_lcd_init_cmd_t lcd_init_cmds[] = {
     {0x11, (uint8_t []){0x00}, 0, 120},   
     {0x36, (uint8_t []){0xF0}, 1, 0},   
-    {0x3A, (uint8_t []){0x55}, 1, 0},  //16bits-RGB565
+    {0x3A, (uint8_t []){LCD_COLMOD}, 1, 0},  //interface pixel format, see LCD_BIT_PER_PIXEL
     {0x2A, (uint8_t []){0x00,0x00,0x02,0x17}, 4, 0}, 
     {0x2B, (uint8_t []){0x00,0x00,0x00,0xEF}, 4, 0},
+#if EXAMPLE_PIN_NUM_LCD_TE >= 0
+    {0x44, (uint8_t []){0x01, 0xD1}, 2, 0},     //TE scanline
+    {0x35, (uint8_t []){0x00}, 0, 0},           //TE on, V-blank only
+#endif
     {0x51, (uint8_t []){0x00}, 1, 10},
     {0x29, (uint8_t []){0x00}, 0, 10},
     {0x51, (uint8_t []){0xFF}, 1, 0},
@@ -37,45 +64,98 @@ static const sh8601_lcd_init_cmd_t lcd_init_cmds[] = {
 static bool example_notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
     lv_disp_drv_t *disp_driver = (lv_disp_drv_t *)user_ctx;
-    lv_disp_flush_ready(disp_driver);
-    return false;
+    bool task_woken = false;
+    // A diffed flush may be split into several transfers; report ready after the last one
+    if (displayFlushShadowEnabled()) {
+        if (displayFlushTransDone(&task_woken) && displayFlushReady(disp_driver)) {
+            task_woken = true;
+        }
+    } else {
+        if (displayFlushIsLast(disp_driver)) {
+            teSyncFrameDone();
+        }
+        if (displayFlushReady(disp_driver)) {
+            task_woken = true;
+        }
+    }
+    return task_woken;
 }
 
-void displayFlushCb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+// Sends one rendered area to the panel; runs on the flush task in pipeline mode
+static void displayFlushArea(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
+    // everything past this point works in the panel's native orientation
+    lv_area_t panel_area;
+    if (drv->rotated != LV_DISP_ROT_NONE) {
+        color_map = displayRotateArea(drv, area, color_map, &panel_area);
+        if (!color_map) {
+            displayFlushReady(drv);
+            return;
+        }
+        area = &panel_area;
+    }
+
+    if (displayFlushShadowEnabled()) {
+        displayFlushShadowed(drv, area, color_map);
+        return;
+    }
+
     esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t) drv->user_data;
     const int offsetx1 = area->x1;
     const int offsetx2 = area->x2;
-    const int offsety1 = area->y1;
-    const int offsety2 = area->y2;
+    // rows outside the active band are not shown, don't send them
+    const int offsety1 = LV_MAX(area->y1, active_band_y1);
+    const int offsety2 = LV_MIN(area->y2, active_band_y2);
+
+    if (offsety1 > offsety2) {
+        if (displayFlushIsLast(drv)) {
+            te_frame_open = false;
+        }
+        displayFlushReady(drv);
+        return;
+    }
+
+    const int width = offsetx2 - offsetx1 + 1;
+    uint8_t *pixels = (uint8_t *)color_map + (offsety1 - area->y1) * width * LCD_BYTES_PER_PIXEL;
+
+#if LCD_BIT_PER_PIXEL != 16 || LCD_SWAP_RGB565
+    // draw buffers are sized for the wire format, convert in place
+    pixel_to_wire(color_map, (const uint16_t*)color_map, width * (area->y2 - area->y1 + 1));
+#endif
+
+    // the first area of a refresh cycle waits for the panel's TE edge
+    if (!te_frame_open) {
+        teSyncWaitForEdge();
+        te_frame_open = true;
+    }
+    if (displayFlushIsLast(drv)) {
+        te_frame_open = false;
+    }
 
     // copy a buffer's content to a specific area of the display
-    esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
+    esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, pixels);
 }
 
-static void displayUpdateCallback(lv_disp_drv_t *drv)
+void displayFlushCb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
-    esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t) drv->user_data;
+    if (displayPipelineEnabled()) {
+        displayPipelineSubmit(drv, area, color_map);
+        return;
+    }
+    displayFlushArea(drv, area, color_map);
+}
 
-    switch (drv->rotated)
-    {
-        case LV_DISP_ROT_NONE:
-            esp_lcd_panel_swap_xy(panel_handle, false);
-            esp_lcd_panel_mirror(panel_handle, true, false);
-            break;
-        case LV_DISP_ROT_90:
-            esp_lcd_panel_swap_xy(panel_handle, true);
-            esp_lcd_panel_mirror(panel_handle, true, true);
-            break;
-        case LV_DISP_ROT_180:
-            esp_lcd_panel_swap_xy(panel_handle, false);
-            esp_lcd_panel_mirror(panel_handle, false, true);
-            break;
-        case LV_DISP_ROT_270:
-            esp_lcd_panel_swap_xy(panel_handle, true);
-            esp_lcd_panel_mirror(panel_handle, false, false);
-            break;
+static void displayUpdateCallback(lv_disp_drv_t *drv)
+{
+    // The SH8601 cannot swap axes, so the panel stays in its native
+    // orientation and displayFlushArea() rotates in software instead
+    if (drv->rotated != LV_DISP_ROT_NONE) {
+        displayRotateInit();
     }
+
+    // Everything is redrawn in the new orientation; the shadow no longer
+    // says anything about what the panel shows
+    displayFlushInvalidateShadow();
 }
 
 void displayRounderCallback(struct _lv_disp_drv_t *disp_drv, lv_area_t *area)
@@ -85,6 +165,7 @@ void displayRounderCallback(struct _lv_disp_drv_t *disp_drv, lv_area_t *area)
     uint16_t y1 = area->y1;
     uint16_t y2 = area->y2;
 
+    // in LVGL's coordinates; displayRotateMapArea() keeps this alignment on the panel
     // round the start of coordinate down to the nearest 2M number
     area->x1 = (x1 >> 1) << 1;
     area->y1 = (y1 >> 1) << 1;
@@ -93,74 +174,90 @@ void displayRounderCallback(struct _lv_disp_drv_t *disp_drv, lv_area_t *area)
     area->y2 = ((y2 >> 1) << 1) + 1;
 }
 
+static void displayMonitorCb(lv_disp_drv_t *drv, uint32_t time, uint32_t px) {
+    refreshGovernorMonitorCb(drv, time, px);
+    perfMonitorFrame(time, px);
+}
+
 #if EXAMPLE_USE_TOUCH
-bool initTouch() {
-    i2c_config_t i2c_conf;
-    i2c_conf.mode = I2C_MODE_MASTER;
-    i2c_conf.sda_io_num = EXAMPLE_PIN_NUM_TOUCH_SDA;
-    i2c_conf.sda_pullup_en = GPIO_PULLUP_ENABLE;
-    i2c_conf.scl_io_num = EXAMPLE_PIN_NUM_TOUCH_SCL;
-    i2c_conf.scl_pullup_en = GPIO_PULLUP_ENABLE;
-    i2c_conf.master.clk_speed = 300 * 1000;
-    
-    ESP_ERROR_CHECK(i2c_param_config(TOUCH_HOST, &i2c_conf));
-    ESP_ERROR_CHECK(i2c_driver_install(TOUCH_HOST, i2c_conf.mode, 0, 0, 0));
+void touchReadCb(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
+    const int64_t sampleUs = touchInputRead(indev_drv, data);
+    perfMonitorTouchSample(sampleUs, data->state == LV_INDEV_STATE_PRESSED);
+    gestureFeed(indev_drv->disp, sampleUs, data);
 
-    uint8_t data = 0x00;
-    esp_err_t ret = i2c_master_write_to_device(TOUCH_HOST, I2C_ADDR_FT3168, &data, 1, 1000);
-    
-    if (ret == ESP_OK) {
-        Serial.println("Touch controller initialized");
-        return true;
+    TouchPoints points;
+    touchInputGetPoints(&points);
+    gestureFeedPoints(points);
+}
+#else
+void touchReadCb(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
+    data->state = LV_INDEV_STATE_RELEASED;
+}
+#endif
+
+// Runs where the flush paths run, see displayPipelineRunCmd()
+static void applyActiveBand(const lv_area_t *band) {
+    const bool full = band->y1 == 0 && band->y2 == SCREEN_HEIGHT - 1;
+
+    if (full) {
+#if DISPLAY_IDLE_USE_IDLE_MODE
+        esp_lcd_sh8601_idle_mode(panel_handle, false);
+#endif
+        esp_lcd_sh8601_partial_mode(panel_handle, false);
     } else {
-        Serial.printf("Touch controller init failed: %d\n", ret);
-        return false;
+        if (esp_lcd_sh8601_set_partial_area(panel_handle, band->y1, band->y2 + 1) != ESP_OK ||
+            esp_lcd_sh8601_partial_mode(panel_handle, true) != ESP_OK) {
+            LOG_W(TAG, "Failed to enter partial display mode");
+            return;
+        }
+#if DISPLAY_IDLE_USE_IDLE_MODE
+        esp_lcd_sh8601_idle_mode(panel_handle, true);
+#endif
     }
+
+    active_band_y1 = band->y1;
+    active_band_y2 = band->y2;
+    displayFlushSetBand(active_band_y1, active_band_y2);
 }
 
-bool getTouchPoint(uint16_t *x, uint16_t *y) {
-    uint8_t data;
-    uint8_t buf[4];
-    esp_err_t ret;
-    
-    uint8_t reg = 0x02;
-    ret = i2c_master_write_read_device(TOUCH_HOST, I2C_ADDR_FT3168, &reg, 1, &data, 1, 1000);
-    if (ret != ESP_OK || !data) {
+bool displaySetActiveBand(int y1, int y2) {
+    // partial mode selects panel rows, which are LVGL columns in portrait
+    const lv_disp_rot_t rotation = lv_disp_get_rotation(NULL);
+    if (rotation == LV_DISP_ROT_90 || rotation == LV_DISP_ROT_270) {
         return false;
     }
-    
-    reg = 0x03;
-    ret = i2c_master_write_read_device(TOUCH_HOST, I2C_ADDR_FT3168, &reg, 1, buf, 4, 1000);
-    if (ret != ESP_OK) {
+    if (rotation == LV_DISP_ROT_180) {
+        const int flipped_y1 = SCREEN_HEIGHT - 1 - y2;
+        y2 = SCREEN_HEIGHT - 1 - y1;
+        y1 = flipped_y1;
+    }
+
+    // keep the band on the even alignment required by displayRounderCallback
+    y1 = LV_MAX(y1, 0) & ~1;
+    y2 = LV_MIN(y2 | 1, SCREEN_HEIGHT - 1);
+    if (y1 > y2) {
         return false;
     }
-    
-    *y = (((uint16_t)buf[0] & 0x0f)<<8) | (uint16_t)buf[1];
-    *x = (((uint16_t)buf[2] & 0x0f)<<8) | (uint16_t)buf[3];
-    
-    if(*x > SCREEN_WIDTH) *x = SCREEN_WIDTH;
-    if(*y > SCREEN_HEIGHT) *y = SCREEN_HEIGHT;
-    *y = SCREEN_HEIGHT - *y;
-    
+
+    const lv_area_t band = {0, (lv_coord_t)y1, SCREEN_WIDTH - 1, (lv_coord_t)y2};
+    displayPipelineRunCmd(applyActiveBand, &band);
+    band_requested = true;
     return true;
 }
 
-void touchReadCb(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
-    uint16_t x, y;
-    
-    if (getTouchPoint(&x, &y)) {
-        data->state = LV_INDEV_STATE_PRESSED;
-        data->point.x = x;
-        data->point.y = y;
-    } else {
-        data->state = LV_INDEV_STATE_RELEASED;
+void displayClearActiveBand() {
+    if (!band_requested) {
+        return;
     }
+
+    const lv_area_t full = {0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1};
+    displayPipelineRunCmd(applyActiveBand, &full);
+    band_requested = false;
+
+    // frame memory outside the band may be stale, redraw everything; the
+    // areas are queued behind the band change
+    lv_obj_invalidate(lv_scr_act());
 }
-#else
-void touchReadCb(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
-    data->state = LV_INDEV_STATE_RELEASED;
-}
-#endif
 
 // LVGL timing is now handled automatically via lv_conf.h
 void lvgl_tick_task(void) {
@@ -180,11 +277,12 @@ static void lvglUnlock(void) {
 }
 
 static void lvglPortTask(void *arg) {
-    ESP_LOGI(TAG, "Starting LVGL task");
+    LOG_I(TAG, "Starting LVGL task");
     uint32_t task_delay_ms = EXAMPLE_LVGL_TASK_MAX_DELAY_MS;
+    refreshGovernorInit(lv_disp_get_default());
     while (1) {
         if (lvglLock(-1)) {
-            task_delay_ms = lv_timer_handler();
+            task_delay_ms = refreshGovernorRunTimers();
             lvglUnlock();
         }
         if (task_delay_ms > EXAMPLE_LVGL_TASK_MAX_DELAY_MS) {
@@ -192,7 +290,7 @@ static void lvglPortTask(void *arg) {
         } else if (task_delay_ms < EXAMPLE_LVGL_TASK_MIN_DELAY_MS) {
             task_delay_ms = EXAMPLE_LVGL_TASK_MIN_DELAY_MS;
         }
-        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+        refreshGovernorSleep(task_delay_ms);
     }
 }
 
@@ -200,20 +298,21 @@ bool initDisplay() {
     static lv_disp_draw_buf_t disp_buf;
     static lv_disp_drv_t disp_drv;
     
-    ESP_LOGI(TAG, "Initialize SPI bus");
+    LOG_I(TAG, "Initialize SPI bus");
     const spi_bus_config_t buscfg = SH8601_PANEL_BUS_QSPI_CONFIG(EXAMPLE_PIN_NUM_LCD_PCLK,
                                                                  EXAMPLE_PIN_NUM_LCD_DATA0,
                                                                  EXAMPLE_PIN_NUM_LCD_DATA1,
                                                                  EXAMPLE_PIN_NUM_LCD_DATA2,
                                                                  EXAMPLE_PIN_NUM_LCD_DATA3,
-                                                                 SCREEN_WIDTH * SCREEN_HEIGHT * LCD_BIT_PER_PIXEL / 8);
+                                                                 SCREEN_WIDTH * SCREEN_HEIGHT * LCD_BYTES_PER_PIXEL);
     ESP_ERROR_CHECK(spi_bus_initialize(LCD_HOST, &buscfg, SPI_DMA_CH_AUTO));
 
-    ESP_LOGI(TAG, "Install panel IO");
+    LOG_I(TAG, "Install panel IO");
     esp_lcd_panel_io_handle_t io_handle = NULL;
-    const esp_lcd_panel_io_spi_config_t io_config = SH8601_PANEL_IO_QSPI_CONFIG(EXAMPLE_PIN_NUM_LCD_CS,
-                                                                                  example_notify_lvgl_flush_ready,
-                                                                                  &disp_drv);
+    esp_lcd_panel_io_spi_config_t io_config = SH8601_PANEL_IO_QSPI_CONFIG(EXAMPLE_PIN_NUM_LCD_CS,
+                                                                            example_notify_lvgl_flush_ready,
+                                                                            &disp_drv);
+    io_config.pclk_hz = lcdClockSelect();
     sh8601_vendor_config_t vendor_config = {
         .init_cmds = lcd_init_cmds,
         .init_cmds_size = sizeof(lcd_init_cmds) / sizeof(lcd_init_cmds[0]),
@@ -231,48 +330,74 @@ bool initDisplay() {
         .vendor_config = &vendor_config,
     };
     
-    ESP_LOGI(TAG, "Install SH8601 panel driver");
+    LOG_I(TAG, "Install SH8601 panel driver");
     ESP_ERROR_CHECK(esp_lcd_new_panel_sh8601(io_handle, &panel_config, &panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_reset(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, true));
 
+    displayFlushInit(panel_handle, io_config.pclk_hz);
+    if (!teSyncInit()) {
+        LOG_I(TAG, "No TE source, flushing unsynchronized");
+    }
+
 #if EXAMPLE_USE_TOUCH
-    if (!initTouch()) {
-        Serial.println("Touch init failed, continuing without touch");
+    if (!touchInputInit()) {
+        LOG_W(TAG, "Touch init failed, continuing without touch");
     }
 #endif
 
-    ESP_LOGI(TAG, "Initialize LVGL library");
+    LOG_I(TAG, "Initialize LVGL library");
     lv_init();
+    lvglMemInit();
+    perfMonitorInit();
     
-    // Allocate draw buffers
-    lv_color_t *buf1 = (lv_color_t*)heap_caps_malloc(SCREEN_WIDTH * EXAMPLE_LVGL_BUF_HEIGHT * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    // Allocate draw buffers, large enough to be converted to the wire format in place
+    const size_t buf_bytes = SCREEN_WIDTH * EXAMPLE_LVGL_BUF_HEIGHT * LV_MAX(sizeof(lv_color_t), LCD_BYTES_PER_PIXEL);
+    lv_color_t *buf1 = (lv_color_t*)heap_caps_malloc(buf_bytes, MALLOC_CAP_DMA);
     if (!buf1) {
-        Serial.println("Failed to allocate display buffer 1!");
+        LOG_E(TAG, "Failed to allocate display buffer 1!");
         return false;
     }
     
-    lv_color_t *buf2 = (lv_color_t*)heap_caps_malloc(SCREEN_WIDTH * EXAMPLE_LVGL_BUF_HEIGHT * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    lv_color_t *buf2 = (lv_color_t*)heap_caps_malloc(buf_bytes, MALLOC_CAP_DMA);
     if (!buf2) {
-        Serial.println("Failed to allocate display buffer 2!");
+        LOG_E(TAG, "Failed to allocate display buffer 2!");
         return false;
     }
     
+#if DISPLAY_PIPELINE
+    lv_color_t *buf3 = (lv_color_t*)heap_caps_malloc(buf_bytes, MALLOC_CAP_DMA);
+    if (!buf3) {
+        LOG_W(TAG, "Failed to allocate display buffer 3, flushing without the pipeline");
+    }
+#endif
+
     lv_disp_draw_buf_init(&disp_buf, buf1, buf2, SCREEN_WIDTH * EXAMPLE_LVGL_BUF_HEIGHT);
 
-    ESP_LOGI(TAG, "Register display driver to LVGL");
+    LOG_I(TAG, "Register display driver to LVGL");
     lv_disp_drv_init(&disp_drv);
     disp_drv.hor_res = SCREEN_WIDTH;
     disp_drv.ver_res = SCREEN_HEIGHT;
     disp_drv.flush_cb = displayFlushCb;
     disp_drv.rounder_cb = displayRounderCallback;
     disp_drv.drv_update_cb = displayUpdateCallback;
+    disp_drv.monitor_cb = displayMonitorCb;
     disp_drv.draw_buf = &disp_buf;
     disp_drv.user_data = panel_handle;
+    disp_drv.rotated = DISPLAY_ROTATION;
+    if (DISPLAY_ROTATION != LV_DISP_ROT_NONE && !displayRotateInit()) {
+        disp_drv.rotated = LV_DISP_ROT_NONE;
+    }
     lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
 
-    ESP_LOGI(TAG, "LVGL initialization completed - call lvgl_tick_task() from main loop");
+#if DISPLAY_PIPELINE
+    if (buf3 && !displayPipelineInit(&disp_drv, displayFlushArea, buf3)) {
+        heap_caps_free(buf3);
+    }
+#endif
+
+    LOG_I(TAG, "LVGL initialization completed - call lvgl_tick_task() from main loop");
     
     // Note: Call lvgl_tick_task() regularly from main loop for timing
 
@@ -283,17 +408,18 @@ bool initDisplay() {
     indev_drv.disp = disp;
     indev_drv.read_cb = touchReadCb;
     touch_indev = lv_indev_drv_register(&indev_drv);
-    Serial.println("Touch input device registered");
+    LOG_I(TAG, "Touch input device registered");
 #endif
 
     lvgl_mux = xSemaphoreCreateMutex();
     if (!lvgl_mux) {
-        Serial.println("Failed to create LVGL mutex!");
+        LOG_E(TAG, "Failed to create LVGL mutex!");
         return false;
     }
     
-    xTaskCreate(lvglPortTask, "LVGL", EXAMPLE_LVGL_TASK_STACK_SIZE, NULL, EXAMPLE_LVGL_TASK_PRIORITY, NULL);
+    xTaskCreatePinnedToCore(lvglPortTask, "LVGL", EXAMPLE_LVGL_TASK_STACK_SIZE, NULL,
+                            EXAMPLE_LVGL_TASK_PRIORITY, NULL, EXAMPLE_LVGL_TASK_CORE);
 
-    Serial.println("Display initialization completed");
+    LOG_I(TAG, "Display initialization completed");
     return true;
 }
\ No newline at end of file
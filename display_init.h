@@ -9,9 +9,11 @@ void lvgl_tick_task(void);  // Call this regularly from main loop
 void displayFlushCb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
 void touchReadCb(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
 
-#if EXAMPLE_USE_TOUCH
-bool initTouch();
-bool getTouchPoint(uint16_t *x, uint16_t *y);
-#endif
+// Partial display: only rows y1..y2 stay lit and get flushed.
+// Must be called from the LVGL task (e.g. an lv_timer callback). The
+// panel switches once the areas already rendered have been flushed; a
+// panel error then is only logged.
+bool displaySetActiveBand(int y1, int y2);
+void displayClearActiveBand();
 
 #endif
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "display_pipeline.h"
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "log_ring.h"
+
+static const char *TAG = "display_pipeline";
+
+// LVGL renders into one buffer while up to two wait for or go out over QSPI
+#define PIPELINE_BUFFERS 3
+// One more job than buffers, so a panel command never blocks the LVGL task
+#define PIPELINE_JOBS (PIPELINE_BUFFERS + 1)
+
+struct FlushJob {
+    lv_area_t area;
+    lv_color_t *buf;
+    bool last;
+    DisplayPanelCmdFn cmd;      // set for a panel command, which has no buffer
+};
+
+static lv_disp_drv_t *pipelineDrv = NULL;
+static DisplayFlushAreaFn flushAreaFn = NULL;
+static QueueHandle_t jobQueue = NULL;       // rendered areas, LVGL task -> flush task
+static QueueHandle_t freeQueue = NULL;      // flushed buffers, flush task -> LVGL task
+static SemaphoreHandle_t doneSem = NULL;
+static volatile bool jobLast = false;       // last area of its cycle, for the flush paths
+static bool enabled = false;
+
+// Busy time bookkeeping. The render side samples the flush task's
+// cumulative busy time at the start and end of each area it draws; the
+// difference is exactly the time both were busy.
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t flushBusySinceUs = 0;
+static uint64_t flushBusyTotalUs = 0;
+static uint64_t renderTotalUs = 0;
+static uint64_t overlapTotalUs = 0;
+static uint32_t renderFrames = 0;
+static uint32_t flushFrames = 0;
+static uint32_t bufferWaits = 0;
+static int64_t renderMarkUs = 0;
+static uint64_t renderMarkBusyUs = 0;
+
+// Cumulative flush busy time up to now; call with statsLock held
+static uint64_t flushBusyUntilNow(int64_t now) {
+    return flushBusyTotalUs + (flushBusySinceUs ? now - flushBusySinceUs : 0);
+}
+
+static void markRenderStart() {
+    portENTER_CRITICAL(&statsLock);
+    renderMarkUs = esp_timer_get_time();
+    renderMarkBusyUs = flushBusyUntilNow(renderMarkUs);
+    portEXIT_CRITICAL(&statsLock);
+}
+
+static void markRenderEnd(bool last) {
+    portENTER_CRITICAL(&statsLock);
+    const int64_t now = esp_timer_get_time();
+    renderTotalUs += now - renderMarkUs;
+    overlapTotalUs += flushBusyUntilNow(now) - renderMarkBusyUs;
+    if (last) {
+        renderFrames++;
+    }
+    portEXIT_CRITICAL(&statsLock);
+}
+
+static void renderStartCb(lv_disp_drv_t *drv) {
+    markRenderStart();
+}
+
+static void flushTask(void *arg) {
+    LOG_I(TAG, "Starting flush task");
+    FlushJob job;
+    while (1) {
+        if (xQueueReceive(jobQueue, &job, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        // The areas queued before it are on the panel, the IO is idle
+        if (job.cmd) {
+            job.cmd(&job.area);
+            continue;
+        }
+
+        portENTER_CRITICAL(&statsLock);
+        flushBusySinceUs = esp_timer_get_time();
+        portEXIT_CRITICAL(&statsLock);
+
+        jobLast = job.last;
+        flushAreaFn(pipelineDrv, &job.area, job.buf);
+        xSemaphoreTake(doneSem, portMAX_DELAY);
+
+        portENTER_CRITICAL(&statsLock);
+        flushBusyTotalUs += esp_timer_get_time() - flushBusySinceUs;
+        flushBusySinceUs = 0;
+        if (job.last) {
+            flushFrames++;
+        }
+        portEXIT_CRITICAL(&statsLock);
+
+        xQueueSend(freeQueue, &job.buf, portMAX_DELAY);
+    }
+}
+
+bool displayPipelineInit(lv_disp_drv_t *drv, DisplayFlushAreaFn flushArea, lv_color_t *spare) {
+    jobQueue = xQueueCreate(PIPELINE_JOBS, sizeof(FlushJob));
+    freeQueue = xQueueCreate(PIPELINE_BUFFERS, sizeof(lv_color_t*));
+    doneSem = xSemaphoreCreateBinary();
+    if (!jobQueue || !freeQueue || !doneSem) {
+        LOG_E(TAG, "Failed to create flush pipeline queues!");
+        return false;
+    }
+
+    pipelineDrv = drv;
+    flushAreaFn = flushArea;
+
+    // LVGL starts in buf1; buf2 and the spare are handed out by displayPipelineSubmit
+    lv_disp_draw_buf_t *draw_buf = drv->draw_buf;
+    xQueueSend(freeQueue, &draw_buf->buf2, 0);
+    xQueueSend(freeQueue, &spare, 0);
+
+    if (xTaskCreatePinnedToCore(flushTask, "LVGL flush", DISPLAY_FLUSH_TASK_STACK_SIZE, NULL,
+                                DISPLAY_FLUSH_TASK_PRIORITY, NULL, DISPLAY_FLUSH_TASK_CORE) != pdPASS) {
+        LOG_E(TAG, "Failed to create flush task!");
+        return false;
+    }
+
+    drv->render_start_cb = renderStartCb;
+    enabled = true;
+    LOG_I(TAG, "Render/flush pipeline enabled, %d buffers", PIPELINE_BUFFERS);
+    return true;
+}
+
+bool displayPipelineEnabled() {
+    return enabled;
+}
+
+void displayPipelineSubmit(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    const bool last = lv_disp_flush_is_last(drv);
+    markRenderEnd(last);
+
+    FlushJob job = {*area, color_map, last};
+    xQueueSend(jobQueue, &job, portMAX_DELAY);
+
+    lv_color_t *next = NULL;
+    if (xQueueReceive(freeQueue, &next, 0) != pdTRUE) {
+        bufferWaits++;
+        xQueueReceive(freeQueue, &next, portMAX_DELAY);
+    }
+
+    // LVGL switches to whichever of buf1/buf2 is not buf_act once this
+    // returns; make that the free buffer. The submitted one stays out of
+    // reach until the flush task gives it back.
+    lv_disp_draw_buf_t *draw_buf = drv->draw_buf;
+    draw_buf->buf1 = next;
+    draw_buf->buf2 = color_map;
+    draw_buf->buf_act = color_map;
+
+    lv_disp_flush_ready(drv);
+    markRenderStart();
+}
+
+bool displayFlushReady(lv_disp_drv_t *drv) {
+    if (!enabled) {
+        lv_disp_flush_ready(drv);
+        return false;
+    }
+
+    if (xPortInIsrContext()) {
+        BaseType_t highPriorityTaskWoken = pdFALSE;
+        xSemaphoreGiveFromISR(doneSem, &highPriorityTaskWoken);
+        return highPriorityTaskWoken == pdTRUE;
+    }
+    xSemaphoreGive(doneSem);
+    return false;
+}
+
+bool displayFlushIsLast(lv_disp_drv_t *drv) {
+    return enabled ? jobLast : lv_disp_flush_is_last(drv);
+}
+
+void displayPipelineRunCmd(DisplayPanelCmdFn cmd, const lv_area_t *area) {
+    if (!enabled) {
+        cmd(area);
+        return;
+    }
+
+    FlushJob job = {*area, NULL, false, cmd};
+    xQueueSend(jobQueue, &job, portMAX_DELAY);
+}
+
+DisplayPipelineStats getDisplayPipelineStats() {
+    DisplayPipelineStats snapshot;
+
+    portENTER_CRITICAL(&statsLock);
+    const uint64_t busy = flushBusyUntilNow(esp_timer_get_time());
+    snapshot.frames = flushFrames;
+    snapshot.renderUs = renderFrames ? renderTotalUs / renderFrames : 0;
+    snapshot.flushUs = flushFrames ? busy / flushFrames : 0;
+    snapshot.overlapPct = busy ? overlapTotalUs * 100 / busy : 0;
+    snapshot.bufferWaits = bufferWaits;
+    portEXIT_CRITICAL(&statsLock);
+
+    return snapshot;
+}
@@ -0,0 +1,45 @@
+#ifndef DISPLAY_PIPELINE_H
+#define DISPLAY_PIPELINE_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// Timing of the render/flush pipeline, averaged per refresh cycle
+struct DisplayPipelineStats {
+    uint32_t frames = 0;
+    uint32_t renderUs = 0;          // LVGL drawing the areas of a cycle
+    uint32_t flushUs = 0;           // flush task busy with a cycle, DMA included
+    uint32_t overlapPct = 0;        // share of flush time during which LVGL was rendering
+    uint32_t bufferWaits = 0;       // areas that had to wait for a free draw buffer
+};
+
+typedef void (*DisplayFlushAreaFn)(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+typedef void (*DisplayPanelCmdFn)(const lv_area_t *area);
+
+// Starts the flush task on DISPLAY_FLUSH_TASK_CORE. The driver's draw
+// buffer must have been set up with buf1/buf2; spare is the third buffer.
+// From then on flushArea runs on the flush task and has to report
+// completion with displayFlushReady() instead of lv_disp_flush_ready().
+bool displayPipelineInit(lv_disp_drv_t *drv, DisplayFlushAreaFn flushArea, lv_color_t *spare);
+bool displayPipelineEnabled();
+
+// flush_cb in pipeline mode: queues the area for the flush task and gives
+// LVGL a free buffer to render the next area into
+void displayPipelineSubmit(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+
+// Used by the flush paths in place of lv_disp_flush_ready() and
+// lv_disp_flush_is_last(), so they work with and without the pipeline.
+// displayFlushReady() is ISR safe and returns true if it woke a task.
+bool displayFlushReady(lv_disp_drv_t *drv);
+bool displayFlushIsLast(lv_disp_drv_t *drv);
+
+// Panel commands and flush path state changes go through here. With the
+// pipeline, cmd runs on the flush task once the areas queued before it
+// have gone out, so it never shares the panel IO with a transfer and
+// never changes what an area rendered before it looks like on the panel.
+// Without the pipeline it runs right away.
+void displayPipelineRunCmd(DisplayPanelCmdFn cmd, const lv_area_t *area);
+
+DisplayPipelineStats getDisplayPipelineStats();
+
+#endif
@@ -0,0 +1,69 @@
+#include "display_rotate.h"
+#include <Arduino.h>
+#include "esp_heap_caps.h"
+#include "log_ring.h"
+#include "pixel_convert.h"
+
+static const char *TAG = "display_rotate";
+
+static_assert(SCREEN_WIDTH % 2 == 0 && SCREEN_HEIGHT % 2 == 0,
+              "rotated areas only keep the rounder's even alignment on an even sized panel");
+
+static lv_color_t *scratchBuf = NULL;
+
+bool displayRotateInit() {
+    if (scratchBuf) {
+        return true;
+    }
+
+    // Same size as a draw buffer, so the direct flush path can still
+    // convert to the wire format in place
+    const size_t bytes = SCREEN_WIDTH * EXAMPLE_LVGL_BUF_HEIGHT * LV_MAX(sizeof(lv_color_t), LCD_BYTES_PER_PIXEL);
+    scratchBuf = (lv_color_t*)heap_caps_malloc(bytes, MALLOC_CAP_DMA);
+    if (!scratchBuf) {
+        LOG_E(TAG, "Failed to allocate rotation buffer!");
+        return false;
+    }
+    LOG_I(TAG, "Software rotation enabled");
+    return true;
+}
+
+void displayRotateMapArea(lv_disp_rot_t rotation, const lv_area_t *area, lv_area_t *panelArea) {
+    switch (rotation) {
+        case LV_DISP_ROT_90:
+            panelArea->x1 = area->y1;
+            panelArea->x2 = area->y2;
+            panelArea->y1 = SCREEN_HEIGHT - 1 - area->x2;
+            panelArea->y2 = SCREEN_HEIGHT - 1 - area->x1;
+            break;
+        case LV_DISP_ROT_180:
+            panelArea->x1 = SCREEN_WIDTH - 1 - area->x2;
+            panelArea->x2 = SCREEN_WIDTH - 1 - area->x1;
+            panelArea->y1 = SCREEN_HEIGHT - 1 - area->y2;
+            panelArea->y2 = SCREEN_HEIGHT - 1 - area->y1;
+            break;
+        case LV_DISP_ROT_270:
+            panelArea->x1 = SCREEN_WIDTH - 1 - area->y2;
+            panelArea->x2 = SCREEN_WIDTH - 1 - area->y1;
+            panelArea->y1 = area->x1;
+            panelArea->y2 = area->x2;
+            break;
+        default:
+            *panelArea = *area;
+            break;
+    }
+}
+
+lv_color_t *displayRotateArea(lv_disp_drv_t *drv, const lv_area_t *area, const lv_color_t *color_map, lv_area_t *panelArea) {
+    if (!scratchBuf) {
+        return NULL;
+    }
+
+    const lv_disp_rot_t rotation = (lv_disp_rot_t)drv->rotated;
+    const int degrees = rotation == LV_DISP_ROT_90 ? 90 : rotation == LV_DISP_ROT_180 ? 180 : 270;
+    pixel_rgb565_rotate((uint16_t*)scratchBuf, (const uint16_t*)color_map,
+                        area->x2 - area->x1 + 1, area->y2 - area->y1 + 1, degrees);
+
+    displayRotateMapArea(rotation, area, panelArea);
+    return scratchBuf;
+}
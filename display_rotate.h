@@ -0,0 +1,29 @@
+#ifndef DISPLAY_ROTATE_H
+#define DISPLAY_ROTATE_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// Software rotation for LV_DISP_ROT_90/180/270. The SH8601 cannot swap
+// axes and only mirrors X, so the panel keeps its native orientation and
+// every rendered area is turned in a scratch buffer before it is sent.
+//
+// displayRounderCallback() keeps LVGL's areas on even start and odd end
+// coordinates. Rotation maps x to y and mirrors against the panel size,
+// so with even SCREEN_WIDTH and SCREEN_HEIGHT the panel areas keep the
+// same alignment.
+
+// Allocates the scratch buffer (DMA capable, one draw buffer in size).
+// Safe to call again; only the first call allocates.
+bool displayRotateInit();
+
+// Maps an area in LVGL's (rotated) coordinates to panel coordinates
+void displayRotateMapArea(lv_disp_rot_t rotation, const lv_area_t *area, lv_area_t *panelArea);
+
+// Rotates a rendered area into the scratch buffer and returns it, with
+// panelArea set to where it goes on the panel. Returns NULL if there is
+// no scratch buffer. The buffer is reused by the next call, so the
+// previous area must have been flushed by then.
+lv_color_t *displayRotateArea(lv_disp_drv_t *drv, const lv_area_t *area, const lv_color_t *color_map, lv_area_t *panelArea);
+
+#endif
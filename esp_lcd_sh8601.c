@@ -91,7 +91,7 @@ esp_err_t esp_lcd_new_panel_sh8601(const esp_lcd_panel_io_handle_t io, const esp
     case 18: // RGB666
         sh8601->colmod_val = 0x66;
         // each color component (R/G/B) should occupy the 6 high bits of a byte, which means 3 full bytes are required for a pixel
-        fb_bits_per_pixel = 18;
+        fb_bits_per_pixel = 24;
         break;
     case 24: // RGB888
         sh8601->colmod_val = 0x77;
@@ -251,10 +251,8 @@ static esp_err_t panel_sh8601_init(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static esp_err_t panel_sh8601_draw_bitmap(esp_lcd_panel_t *panel, int x_start, int y_start, int x_end, int y_end, const void *color_data)
+static esp_err_t sh8601_set_window(sh8601_panel_t *sh8601, int x_start, int y_start, int x_end, int y_end)
 {
-    sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
-    assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = sh8601->io;
 
     x_start += sh8601->x_gap ;
@@ -275,6 +273,17 @@ static esp_err_t panel_sh8601_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
         ((y_end - 1) >> 8) & 0xFF,
         (y_end - 1) & 0xFF,
     }, 4), TAG, "send command failed");
+
+    return ESP_OK;
+}
+
+static esp_err_t panel_sh8601_draw_bitmap(esp_lcd_panel_t *panel, int x_start, int y_start, int x_end, int y_end, const void *color_data)
+{
+    sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+    assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
+    esp_lcd_panel_io_handle_t io = sh8601->io;
+
+    ESP_RETURN_ON_ERROR(sh8601_set_window(sh8601, x_start, y_start, x_end, y_end), TAG, "set window failed");
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * sh8601->fb_bits_per_pixel / 8;
     tx_color(sh8601, io, LCD_CMD_RAMWR, color_data, len);
@@ -282,6 +291,103 @@ static esp_err_t panel_sh8601_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
     return ESP_OK;
 }
 
+esp_err_t esp_lcd_sh8601_set_window(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+    assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
+
+    return sh8601_set_window(sh8601, x_start, y_start, x_end, y_end);
+}
+
+esp_err_t esp_lcd_sh8601_write_pixels(esp_lcd_panel_handle_t panel, const void *color_data, size_t len, bool cont)
+{
+    ESP_RETURN_ON_FALSE(panel && color_data && len, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+
+    return tx_color(sh8601, sh8601->io, cont ? LCD_CMD_WRMEMC : LCD_CMD_RAMWR, color_data, len);
+}
+
+esp_err_t esp_lcd_sh8601_set_partial_area(esp_lcd_panel_handle_t panel, int y_start, int y_end)
+{
+    ESP_RETURN_ON_FALSE(panel && y_start < y_end, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+
+    y_start += sh8601->y_gap;
+    y_end += sh8601->y_gap;
+    ESP_RETURN_ON_ERROR(tx_param(sh8601, sh8601->io, LCD_CMD_PTLAR, (uint8_t[]) {
+        (y_start >> 8) & 0xFF,
+        y_start & 0xFF,
+        ((y_end - 1) >> 8) & 0xFF,
+        (y_end - 1) & 0xFF,
+    }, 4), TAG, "send command failed");
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_sh8601_partial_mode(esp_lcd_panel_handle_t panel, bool on)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+
+    ESP_RETURN_ON_ERROR(tx_param(sh8601, sh8601->io, on ? LCD_CMD_PTLON : LCD_CMD_NORON, NULL, 0), TAG,
+                        "send command failed");
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_sh8601_idle_mode(esp_lcd_panel_handle_t panel, bool on)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+
+    ESP_RETURN_ON_ERROR(tx_param(sh8601, sh8601->io, on ? LCD_CMD_IDMON : LCD_CMD_IDMOFF, NULL, 0), TAG,
+                        "send command failed");
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_sh8601_set_scroll_area(esp_lcd_panel_handle_t panel, int top_fixed, int scroll_height, int bottom_fixed)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+
+    ESP_RETURN_ON_ERROR(tx_param(sh8601, sh8601->io, LCD_CMD_VSCRDEF, (uint8_t[]) {
+        (top_fixed >> 8) & 0xFF,
+        top_fixed & 0xFF,
+        (scroll_height >> 8) & 0xFF,
+        scroll_height & 0xFF,
+        (bottom_fixed >> 8) & 0xFF,
+        bottom_fixed & 0xFF,
+    }, 6), TAG, "send command failed");
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_sh8601_set_scroll_start(esp_lcd_panel_handle_t panel, int line)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+
+    ESP_RETURN_ON_ERROR(tx_param(sh8601, sh8601->io, LCD_CMD_VSCSAD, (uint8_t[]) {
+        (line >> 8) & 0xFF,
+        line & 0xFF,
+    }, 2), TAG, "send command failed");
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_sh8601_qspi_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size)
+{
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    lcd_cmd = ((lcd_cmd & 0xff) << 8) | (LCD_OPCODE_WRITE_CMD << 24);
+    return esp_lcd_panel_io_tx_param(io, lcd_cmd, param, param_size);
+}
+
+esp_err_t esp_lcd_sh8601_qspi_rx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, void *param, size_t param_size)
+{
+    ESP_RETURN_ON_FALSE(io && param && param_size, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    lcd_cmd = ((lcd_cmd & 0xff) << 8) | (LCD_OPCODE_READ_CMD << 24);
+    return esp_lcd_panel_io_rx_param(io, lcd_cmd, param, param_size);
+}
+
 static esp_err_t panel_sh8601_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
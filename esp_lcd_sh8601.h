@@ -55,6 +55,129 @@ typedef struct {
  */
 esp_err_t esp_lcd_new_panel_sh8601(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel);
 
+/**
+ * @brief Set the frame memory window used by following `esp_lcd_sh8601_write_pixels` calls
+ *
+ * @note  The window coordinates follow the same convention as `esp_lcd_panel_draw_bitmap`, the end position is exclusive.
+ *
+ * @param[in] panel LCD panel handle returned by `esp_lcd_new_panel_sh8601`
+ * @param[in] x_start Start column index
+ * @param[in] y_start Start row index
+ * @param[in] x_end End column index (exclusive)
+ * @param[in] y_end End row index (exclusive)
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_lcd_sh8601_set_window(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end);
+
+/**
+ * @brief Queue pixel data into the window set by `esp_lcd_sh8601_set_window`
+ *
+ * @note  The transfer is queued and completion is reported through `on_color_trans_done`, so a large window can be
+ *        streamed from a small DMA buffer in several chunks.
+ *
+ * @param[in] panel LCD panel handle returned by `esp_lcd_new_panel_sh8601`
+ * @param[in] color_data Pixel data in the panel's wire format
+ * @param[in] len Length of `color_data` in bytes
+ * @param[in] cont false to start at the window origin (RAMWR), true to continue after the previous write (RAMWRC)
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_lcd_sh8601_write_pixels(esp_lcd_panel_handle_t panel, const void *color_data, size_t len, bool cont);
+
+/**
+ * @brief Set the rows shown while partial display mode is on (PTLAR)
+ *
+ * @param[in] panel LCD panel handle returned by `esp_lcd_new_panel_sh8601`
+ * @param[in] y_start Start row index
+ * @param[in] y_end End row index (exclusive)
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_lcd_sh8601_set_partial_area(esp_lcd_panel_handle_t panel, int y_start, int y_end);
+
+/**
+ * @brief Turn partial display mode on (PTLON) or go back to normal display mode (NORON)
+ *
+ * @note  In partial mode only the rows set by `esp_lcd_sh8601_set_partial_area` are driven, the rest of the panel
+ *        stays dark. Frame memory outside the area keeps its content.
+ *
+ * @param[in] panel LCD panel handle returned by `esp_lcd_new_panel_sh8601`
+ * @param[in] on true to enter partial mode, false for normal mode
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_lcd_sh8601_partial_mode(esp_lcd_panel_handle_t panel, bool on);
+
+/**
+ * @brief Turn idle mode (reduced 8 color display, IDMON/IDMOFF) on or off
+ *
+ * @param[in] panel LCD panel handle returned by `esp_lcd_new_panel_sh8601`
+ * @param[in] on true to enter idle mode
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_lcd_sh8601_idle_mode(esp_lcd_panel_handle_t panel, bool on);
+
+/**
+ * @brief Define the vertical scrolling area (VSCRDEF)
+ *
+ * @note  `top_fixed + scroll_height + bottom_fixed` should cover all rows of the panel.
+ *
+ * @param[in] panel LCD panel handle returned by `esp_lcd_new_panel_sh8601`
+ * @param[in] top_fixed Number of fixed rows at the top
+ * @param[in] scroll_height Number of rows in the scrolling area
+ * @param[in] bottom_fixed Number of fixed rows at the bottom
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_lcd_sh8601_set_scroll_area(esp_lcd_panel_handle_t panel, int top_fixed, int scroll_height, int bottom_fixed);
+
+/**
+ * @brief Set the frame memory row shown at the top of the scrolling area (VSCSAD)
+ *
+ * @param[in] panel LCD panel handle returned by `esp_lcd_new_panel_sh8601`
+ * @param[in] line Row index in frame memory
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_lcd_sh8601_set_scroll_start(esp_lcd_panel_handle_t panel, int line);
+
+/**
+ * @brief Send a command with parameters over a QSPI panel IO, using the SH8601 command framing (opcode 0x02)
+ *
+ * @note  Works on a bare panel IO handle, e.g. one created at a trial clock rate before any panel exists
+ *
+ * @param[in] io LCD panel IO handle created with `SH8601_PANEL_IO_QSPI_CONFIG`
+ * @param[in] lcd_cmd Command
+ * @param[in] param Parameter bytes, may be NULL if `param_size` is 0
+ * @param[in] param_size Number of parameter bytes
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_lcd_sh8601_qspi_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size);
+
+/**
+ * @brief Read a register over a QSPI panel IO, using the SH8601 read framing (opcode 0x03)
+ *
+ * @param[in]  io LCD panel IO handle created with `SH8601_PANEL_IO_QSPI_CONFIG`
+ * @param[in]  lcd_cmd Register to read, e.g. `LCD_CMD_RDDID`
+ * @param[out] param Buffer for the returned bytes
+ * @param[in]  param_size Number of bytes to read
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_lcd_sh8601_qspi_rx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, void *param, size_t param_size);
+
 /**
  * @brief LCD panel bus configuration structure
  *
@@ -0,0 +1,291 @@
+#include "gesture.h"
+#include <Arduino.h>
+#include <math.h>
+#include <stdlib.h>
+
+#define HISTORY_SIZE        32          // power of two
+#define VELOCITY_TAU_US     30000.0f    // smoothing time constant
+#define FLING_WINDOW_US     80000       // samples used for the release velocity
+
+static_assert((HISTORY_SIZE & (HISTORY_SIZE - 1)) == 0, "HISTORY_SIZE must be a power of two");
+
+struct GestureTracker {
+    bool down = false;
+    bool ignore = false;    // horizontal drag or cancelled, sit out until release
+    bool moved = false;
+    bool intent = false;
+    TouchPoint start = {};
+    TouchPoint last = {};
+    int64_t firstMotionUs = 0;
+    float vx = 0;
+    float vy = 0;
+    float ay = 0;
+    lv_dir_t dir = LV_DIR_NONE;
+};
+
+struct PinchTracker {
+    bool active = false;
+    bool fired = false;
+    int64_t lastUs = 0;
+    float startDist = 0;
+};
+
+static TouchPoint history[HISTORY_SIZE];
+static uint32_t historyCount = 0;
+static GestureTracker tracker;
+static PinchTracker pinch;
+static GestureHandlerFn handler = NULL;
+static void *handlerCtx = NULL;
+static GestureStats stats;
+
+void gestureSetHandler(GestureHandlerFn fn, void *ctx) {
+    handler = fn;
+    handlerCtx = ctx;
+}
+
+void gestureCancel() {
+    if (tracker.down) {
+        tracker.ignore = true;
+    }
+}
+
+GestureStats getGestureStats() {
+    return stats;
+}
+
+// Same transform LVGL applies to pointer input on a rotated display
+static void toScreenCoords(lv_disp_t *disp, TouchPoint *p) {
+    const lv_disp_drv_t *drv = disp ? disp->driver : NULL;
+    if (!drv) {
+        return;
+    }
+    if (drv->rotated == LV_DISP_ROT_180 || drv->rotated == LV_DISP_ROT_270) {
+        p->x = drv->hor_res - p->x - 1;
+        p->y = drv->ver_res - p->y - 1;
+    }
+    if (drv->rotated == LV_DISP_ROT_90 || drv->rotated == LV_DISP_ROT_270) {
+        const lv_coord_t tmp = p->y;
+        p->y = p->x;
+        p->x = drv->ver_res - tmp - 1;
+    }
+}
+
+static const TouchPoint &historyAt(uint32_t age) {
+    return history[(historyCount - 1 - age) & (HISTORY_SIZE - 1)];
+}
+
+// Least squares slope over the pressed samples of the last FLING_WINDOW_US.
+// Smoother than the running estimate when the finger slows down just
+// before lifting off.
+static bool flingVelocity(float *vx, float *vy) {
+    // the newest sample is the release, which repeats the last position
+    const uint32_t available = historyCount < HISTORY_SIZE ? historyCount : HISTORY_SIZE;
+    if (available < 4) {
+        return false;
+    }
+    const int64_t endUs = historyAt(1).timeUs;
+
+    float st = 0, sx = 0, sy = 0, stt = 0, stx = 0, sty = 0;
+    int n = 0;
+    for (uint32_t age = 1; age < available; age++) {
+        const TouchPoint &p = historyAt(age);
+        if (!p.pressed || endUs - p.timeUs > FLING_WINDOW_US || p.timeUs < tracker.start.timeUs) {
+            break;
+        }
+        const float t = (p.timeUs - endUs) / 1e6f;
+        st += t;
+        sx += p.x;
+        sy += p.y;
+        stt += t * t;
+        stx += t * p.x;
+        sty += t * p.y;
+        n++;
+    }
+    const float den = n * stt - st * st;
+    if (n < 3 || den <= 0) {
+        return false;
+    }
+    *vx = (n * stx - st * sx) / den;
+    *vy = (n * sty - st * sy) / den;
+    return true;
+}
+
+static void emit(GestureType type) {
+    if (!handler) {
+        return;
+    }
+    GestureEvent event;
+    event.type = type;
+    event.dir = tracker.dir;
+    event.dx = tracker.last.x - tracker.start.x;
+    event.dy = tracker.last.y - tracker.start.y;
+    event.vx = tracker.vx;
+    event.vy = tracker.vy;
+    event.ay = tracker.ay;
+    event.scale = 1.0f;
+    handler(event, handlerCtx);
+}
+
+static void recordLatency(int64_t nowUs) {
+    const uint32_t us = (uint32_t)(nowUs - tracker.firstMotionUs);
+    stats.swipes++;
+    stats.latencyUs = us;
+    stats.latencyAvgUs = stats.latencyAvgUs ? (stats.latencyAvgUs * 7 + us) / 8 : us;
+    if (us > stats.latencyMaxUs) {
+        stats.latencyMaxUs = us;
+    }
+}
+
+static void checkIntent(const TouchPoint &p) {
+    const int dx = p.x - tracker.start.x;
+    const int dy = p.y - tracker.start.y;
+
+    if (abs(dx) > GESTURE_INTENT_PX && abs(dx) > abs(dy)) {
+        // sideways, e.g. dragging a bar
+        tracker.ignore = true;
+        return;
+    }
+    if (fabsf(tracker.vy) < 2 * fabsf(tracker.vx) && abs(dy) < 2 * abs(dx)) {
+        return;
+    }
+
+    // Where the finger will be GESTURE_PREDICT_MS from now
+    const float h = GESTURE_PREDICT_MS / 1000.0f;
+    const float projected = dy + tracker.vy * h + 0.5f * tracker.ay * h * h;
+    const bool fast = fabsf(projected) >= GESTURE_INTENT_PX && fabsf(tracker.vy) >= GESTURE_INTENT_MIN_SPEED;
+    const bool far = abs(dy) >= 2 * GESTURE_INTENT_PX;
+    if (!fast && !far) {
+        return;
+    }
+
+    tracker.intent = true;
+    tracker.dir = (fast ? projected : dy) < 0 ? LV_DIR_TOP : LV_DIR_BOTTOM;
+    recordLatency(p.timeUs);
+    emit(GESTURE_SWIPE_INTENT);
+}
+
+void gestureFeed(lv_disp_t *disp, int64_t timeUs, const lv_indev_data_t *data) {
+    TouchPoint p;
+    p.timeUs = timeUs;
+    p.x = data->point.x;
+    p.y = data->point.y;
+    p.pressed = data->state == LV_INDEV_STATE_PRESSED;
+    toScreenCoords(disp, &p);
+
+    // LVGL may read faster than the touch task samples
+    if (historyCount && historyAt(0).timeUs == p.timeUs && historyAt(0).pressed == p.pressed) {
+        return;
+    }
+    history[historyCount++ & (HISTORY_SIZE - 1)] = p;
+    stats.samples++;
+
+    if (!p.pressed) {
+        if (tracker.down && tracker.intent && !tracker.ignore) {
+            float vx, vy;
+            if (flingVelocity(&vx, &vy)) {
+                tracker.vx = vx;
+                tracker.vy = vy;
+            }
+            emit(GESTURE_RELEASE);
+        }
+        tracker.down = false;
+        return;
+    }
+
+    if (!tracker.down) {
+        tracker = GestureTracker();
+        tracker.down = true;
+        tracker.start = p;
+        tracker.last = p;
+        return;
+    }
+
+    const float dt = (float)(p.timeUs - tracker.last.timeUs);
+    if (tracker.ignore || dt <= 0) {
+        tracker.last = p;
+        return;
+    }
+
+    // Exponential smoothing with a time constant, so uneven sample spacing
+    // weighs each sample by how much time it covers
+    const float alpha = dt / (dt + VELOCITY_TAU_US);
+    const float prevVy = tracker.vy;
+    tracker.vx += alpha * ((p.x - tracker.last.x) * 1e6f / dt - tracker.vx);
+    tracker.vy += alpha * ((p.y - tracker.last.y) * 1e6f / dt - tracker.vy);
+    tracker.ay += alpha * ((tracker.vy - prevVy) * 1e6f / dt - tracker.ay);
+    tracker.last = p;
+
+    if (!tracker.moved) {
+        const int dx = abs(p.x - tracker.start.x);
+        const int dy = abs(p.y - tracker.start.y);
+        // latency counts from the first sample that left the touch down point
+        if (!tracker.firstMotionUs && (dx || dy)) {
+            tracker.firstMotionUs = p.timeUs;
+        }
+        if (dx <= GESTURE_SLOP_PX && dy <= GESTURE_SLOP_PX) {
+            return;
+        }
+        tracker.moved = true;
+    }
+
+    if (tracker.intent) {
+        emit(GESTURE_DRAG);
+    } else {
+        checkIntent(p);
+    }
+}
+
+void gestureFeedPoints(const TouchPoints &points) {
+    if (points.timeUs == pinch.lastUs) {
+        return;
+    }
+    pinch.lastUs = points.timeUs;
+
+    if (points.count < 2) {
+        pinch.active = false;
+        return;
+    }
+
+    // Rotation does not change the distance, panel coordinates will do
+    const float dx = (float)points.point[1].x - points.point[0].x;
+    const float dy = (float)points.point[1].y - points.point[0].y;
+    const float dist = sqrtf(dx * dx + dy * dy);
+
+    if (!pinch.active) {
+        pinch = PinchTracker();
+        pinch.active = true;
+        pinch.lastUs = points.timeUs;
+        pinch.startDist = dist;
+        // the first finger was not a swipe after all
+        if (tracker.down && tracker.intent && !tracker.ignore) {
+            tracker.vx = 0;
+            tracker.vy = 0;
+            emit(GESTURE_RELEASE);
+        }
+        gestureCancel();
+        return;
+    }
+    if (pinch.fired || pinch.startDist < 1) {
+        return;
+    }
+
+    const float scale = dist / pinch.startDist;
+    GestureType type;
+    if (scale <= 1.0f - GESTURE_PINCH_PERCENT / 100.0f) {
+        type = GESTURE_PINCH_IN;
+    } else if (scale >= 1.0f + GESTURE_PINCH_PERCENT / 100.0f) {
+        type = GESTURE_PINCH_OUT;
+    } else {
+        return;
+    }
+
+    pinch.fired = true;
+    stats.pinches++;
+    if (handler) {
+        GestureEvent event = {};
+        event.type = type;
+        event.dir = LV_DIR_NONE;
+        event.scale = scale;
+        handler(event, handlerCtx);
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <lvgl.h>
+#include "config.h"
+#include "touch_input.h"
+
+// Swipe recognition on the raw touch stream. Every indev read is pushed
+// into a ring of timestamped samples; velocity and acceleration are
+// smoothed sample by sample, so a vertical swipe is recognized from the
+// projected travel while the finger is still moving instead of after
+// release. A second finger turns the touch into a pinch, recognized from
+// the ratio of the finger distance to the one at the second touch down.
+// Runs on the LVGL task.
+
+struct TouchPoint {
+    int64_t timeUs;         // when the controller was read
+    lv_coord_t x;           // screen coordinates, after display rotation
+    lv_coord_t y;
+    bool pressed;
+};
+
+enum GestureType : uint8_t {
+    GESTURE_SWIPE_INTENT,   // travel and speed committed to a vertical swipe
+    GESTURE_DRAG,           // finger moved after the intent
+    GESTURE_RELEASE,        // finger lifted after the intent, vy is the fling velocity
+    GESTURE_PINCH_IN,       // two fingers closed by GESTURE_PINCH_PERCENT
+    GESTURE_PINCH_OUT,      // two fingers spread by GESTURE_PINCH_PERCENT
+};
+
+struct GestureEvent {
+    GestureType type;
+    lv_dir_t dir;           // LV_DIR_TOP or LV_DIR_BOTTOM, the way the finger travels
+    lv_coord_t dx;          // travel since touch down
+    lv_coord_t dy;
+    float vx;               // px/s
+    float vy;
+    float ay;               // px/s^2
+    float scale;            // pinch only, finger distance over the starting one
+};
+
+typedef void (*GestureHandlerFn)(const GestureEvent &event, void *ctx);
+
+struct GestureStats {
+    uint32_t samples = 0;
+    uint32_t swipes = 0;
+    uint32_t latencyUs = 0;     // first motion to swipe intent, last swipe
+    uint32_t latencyAvgUs = 0;  // running average
+    uint32_t latencyMaxUs = 0;
+    uint32_t pinches = 0;
+};
+
+void gestureSetHandler(GestureHandlerFn fn, void *ctx);
+
+// Feeds one indev sample, in the touch controller's coordinates. Call from
+// the indev read callback after the sample has been filled in.
+void gestureFeed(lv_disp_t *disp, int64_t timeUs, const lv_indev_data_t *data);
+
+// Feeds the multi-point report of the same read. One pinch event is sent
+// per two-finger contact, and the second finger cancels any swipe.
+void gestureFeedPoints(const TouchPoints &points);
+
+// Ignores the rest of the current touch
+void gestureCancel();
+
+GestureStats getGestureStats();
+
+#endif
@@ -0,0 +1,173 @@
+#include "glyph_cache.h"
+#include <Arduino.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "log_ring.h"
+
+static const char *TAG = "glyph_cache";
+
+struct GlyphCacheEntry {
+    const lv_font_t *font;
+    uint32_t letter;
+    uint32_t lastUse;
+    uint32_t capacity;
+    uint8_t *data;
+};
+
+static GlyphCacheEntry entries[GLYPH_CACHE_ENTRIES];
+static uint32_t useClock = 0;
+// Written on the LVGL task, read by getGlyphCacheStats() on the loop task
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+static GlyphCacheStats stats;
+
+// Same lookup LVGL's fmt_txt fonts do, id 0 when the font lacks the letter
+static uint32_t glyphId(const lv_font_fmt_txt_dsc_t *fdsc, uint32_t letter) {
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        const uint32_t rcp = letter - cmap->range_start;
+        if (letter < cmap->range_start || rcp >= cmap->range_length) {
+            continue;
+        }
+
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            return cmap->glyph_id_start + rcp;
+        }
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            const uint8_t *ofs = (const uint8_t *)cmap->glyph_id_ofs_list;
+            return cmap->glyph_id_start + ofs[rcp];
+        }
+
+        // sparse: unicode_list holds the sorted offsets from range_start
+        uint16_t lo = 0, hi = cmap->list_length;
+        while (lo < hi) {
+            const uint16_t mid = (lo + hi) / 2;
+            if (cmap->unicode_list[mid] < rcp) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo == cmap->list_length || cmap->unicode_list[lo] != rcp) {
+            continue;
+        }
+        if (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+            return cmap->glyph_id_start + lo;
+        }
+        const uint16_t *ofs = (const uint16_t *)cmap->glyph_id_ofs_list;
+        return cmap->glyph_id_start + ofs[lo];
+    }
+    return 0;
+}
+
+static uint32_t readRun(const uint8_t **src) {
+    uint32_t value = 0;
+    uint8_t shift = 0;
+    uint8_t b;
+    do {
+        b = *(*src)++;
+        value |= (uint32_t)(b & 0x7f) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    return value;
+}
+
+static void decode(uint8_t *dst, const uint8_t *src, uint32_t bits) {
+    memset(dst, 0, (bits + 7) / 8);
+
+    uint32_t pos = 0;
+    bool set = false;
+    while (pos < bits) {
+        uint32_t run = readRun(&src);
+        if (run > bits - pos) {
+            run = bits - pos;
+        }
+        if (set) {
+            // leading partial byte, whole bytes, trailing partial byte
+            uint32_t end = pos + run;
+            while (pos < end && (pos & 7)) {
+                dst[pos >> 3] |= 0x80 >> (pos & 7);
+                pos++;
+            }
+            if (end - pos >= 8) {
+                memset(&dst[pos >> 3], 0xff, (end - pos) >> 3);
+                pos += (end - pos) & ~7u;
+            }
+            while (pos < end) {
+                dst[pos >> 3] |= 0x80 >> (pos & 7);
+                pos++;
+            }
+        } else {
+            pos += run;
+        }
+        set = !set;
+    }
+}
+
+extern "C" const uint8_t *glyphCacheGetBitmap(const lv_font_t *font, uint32_t letter) {
+    GlyphCacheEntry *victim = &entries[0];
+    for (int i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+        GlyphCacheEntry *e = &entries[i];
+        if (e->font == font && e->letter == letter && e->data) {
+            e->lastUse = ++useClock;
+            portENTER_CRITICAL(&statsLock);
+            stats.hits++;
+            portEXIT_CRITICAL(&statsLock);
+            return e->data;
+        }
+        if (e->lastUse < victim->lastUse) {
+            victim = e;
+        }
+    }
+
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    const uint32_t gid = glyphId(fdsc, letter);
+    if (!gid) {
+        return NULL;
+    }
+    const lv_font_fmt_txt_glyph_dsc_t *gdsc = &fdsc->glyph_dsc[gid];
+    const uint32_t bits = (uint32_t)gdsc->box_w * gdsc->box_h;
+    const uint32_t size = (bits + 7) / 8;
+    if (!size) {
+        return NULL;
+    }
+
+    portENTER_CRITICAL(&statsLock);
+    stats.misses++;
+    if (victim->font) {
+        stats.evictions++;
+    }
+    portEXIT_CRITICAL(&statsLock);
+    if (victim->capacity < size) {
+        heap_caps_free(victim->data);
+        victim->data = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        const uint32_t capacity = victim->data ? size : 0;
+        portENTER_CRITICAL(&statsLock);
+        stats.bytes += capacity - victim->capacity;
+        const bool firstFailure = !victim->data && !stats.allocFailures++;
+        portEXIT_CRITICAL(&statsLock);
+        victim->capacity = capacity;
+        if (!victim->data) {
+            if (firstFailure) {
+                LOG_E(TAG, "Glyph cache out of memory!");
+            }
+            victim->font = NULL;
+            victim->lastUse = 0;
+            return NULL;
+        }
+    }
+
+    decode(victim->data, &fdsc->glyph_bitmap[gdsc->bitmap_index], bits);
+    victim->font = font;
+    victim->letter = letter;
+    victim->lastUse = ++useClock;
+    return victim->data;
+}
+
+GlyphCacheStats getGlyphCacheStats() {
+    portENTER_CRITICAL(&statsLock);
+    GlyphCacheStats copy = stats;
+    portEXIT_CRITICAL(&statsLock);
+    return copy;
+}
@@ -0,0 +1,29 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// Bitmap source for fonts that tools/font_subset.py stored RLE compressed.
+// Such a font sets get_glyph_bitmap to glyphCacheGetBitmap. Each glyph is
+// the run lengths of its 1 bpp bitmap, rows joined end to end, starting
+// with a run of clear bits; every run is an unsigned LEB128 number. The
+// last GLYPH_CACHE_ENTRIES decoded glyphs stay in internal RAM, so
+// redrawing a label mostly neither decodes nor reads flash.
+
+struct GlyphCacheStats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;        // decoded from flash
+    uint32_t evictions = 0;
+    uint32_t allocFailures = 0;
+    uint32_t bytes = 0;         // decoded bitmaps held in RAM
+};
+
+// LVGL get_glyph_bitmap callback. The bitmap stays valid until the next
+// GLYPH_CACHE_ENTRIES - 1 lookups of other glyphs. Call from the LVGL task.
+extern "C" const uint8_t *glyphCacheGetBitmap(const lv_font_t *font, uint32_t letter);
+
+// Safe from any task
+GlyphCacheStats getGlyphCacheStats();
+
+#endif
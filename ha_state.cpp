@@ -0,0 +1,242 @@
+#include "ha_state.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum JsonValueType : uint8_t {
+    JSON_STRING,
+    JSON_NUMBER,
+    JSON_TRUE,
+    JSON_FALSE,
+    JSON_NULL,
+    JSON_NESTED,        // object or array, skipped
+};
+
+// A value as it appears in the payload; strings without their quotes,
+// escapes still in place
+struct JsonValue {
+    JsonValueType type;
+    const char* text;
+    size_t length;
+};
+
+typedef void (*JsonFieldCb)(const char* key, size_t keyLength, const JsonValue& value, void* ctx);
+
+static void skipSpace(const char*& p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) {
+        p++;
+    }
+}
+
+// p on the opening quote, left after the closing one
+static bool scanString(const char*& p, const char* end, const char** text, size_t* length) {
+    const char* start = ++p;
+    while (p < end) {
+        if (*p == '\\') {
+            p += 2;
+        } else if (*p == '"') {
+            *text = start;
+            *length = p - start;
+            p++;
+            return true;
+        } else {
+            p++;
+        }
+    }
+    return false;
+}
+
+// Skips an object or array by counting brackets outside strings
+static bool skipNested(const char*& p, const char* end) {
+    uint32_t depth = 0;
+    while (p < end) {
+        const char c = *p;
+        if (c == '"') {
+            const char* text;
+            size_t length;
+            if (!scanString(p, end, &text, &length)) {
+                return false;
+            }
+            continue;
+        }
+        p++;
+        if (c == '{' || c == '[') {
+            depth++;
+        } else if ((c == '}' || c == ']') && --depth == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool scanLiteral(const char*& p, const char* end, const char* literal, size_t length) {
+    if ((size_t)(end - p) < length || memcmp(p, literal, length) != 0) {
+        return false;
+    }
+    p += length;
+    return true;
+}
+
+static bool scanValue(const char*& p, const char* end, JsonValue* value) {
+    if (p >= end) {
+        return false;
+    }
+    value->text = p;
+    value->length = 0;
+    switch (*p) {
+        case '"':
+            value->type = JSON_STRING;
+            return scanString(p, end, &value->text, &value->length);
+        case '{':
+        case '[':
+            value->type = JSON_NESTED;
+            return skipNested(p, end);
+        case 't':
+            value->type = JSON_TRUE;
+            return scanLiteral(p, end, "true", 4);
+        case 'f':
+            value->type = JSON_FALSE;
+            return scanLiteral(p, end, "false", 5);
+        case 'n':
+            value->type = JSON_NULL;
+            return scanLiteral(p, end, "null", 4);
+        default:
+            value->type = JSON_NUMBER;
+            while (p < end && *p && strchr("0123456789+-.eE", *p)) {
+                p++;
+            }
+            value->length = p - value->text;
+            return value->length > 0;
+    }
+}
+
+// Calls cb for every member of the top level object, in order
+static bool scanObject(const char* json, size_t length, JsonFieldCb cb, void* ctx) {
+    const char* p = json;
+    const char* end = json + length;
+
+    skipSpace(p, end);
+    if (p >= end || *p++ != '{') {
+        return false;
+    }
+    skipSpace(p, end);
+    if (p < end && *p == '}') {
+        p++;
+    } else {
+        while (true) {
+            const char* key;
+            size_t keyLength;
+            JsonValue value;
+            if (p >= end || *p != '"' || !scanString(p, end, &key, &keyLength)) {
+                return false;
+            }
+            skipSpace(p, end);
+            if (p >= end || *p++ != ':') {
+                return false;
+            }
+            skipSpace(p, end);
+            if (!scanValue(p, end, &value)) {
+                return false;
+            }
+            cb(key, keyLength, value, ctx);
+
+            skipSpace(p, end);
+            if (p >= end) {
+                return false;
+            }
+            const char c = *p++;
+            if (c == '}') {
+                break;
+            }
+            if (c != ',') {
+                return false;
+            }
+            skipSpace(p, end);
+        }
+    }
+    skipSpace(p, end);
+    return p == end;
+}
+
+static bool keyIs(const char* key, size_t keyLength, const char* name) {
+    return keyLength == strlen(name) && memcmp(key, name, keyLength) == 0;
+}
+
+static bool valueIs(const JsonValue& value, const char* text) {
+    return value.type == JSON_STRING && keyIs(value.text, value.length, text);
+}
+
+static bool toFloat(const JsonValue& value, float* out) {
+    char number[24];
+    if (value.type != JSON_NUMBER || value.length >= sizeof(number)) {
+        return false;
+    }
+    memcpy(number, value.text, value.length);
+    number[value.length] = '\0';
+    char* parsed;
+    const float result = strtof(number, &parsed);
+    if (parsed != number + value.length || !isfinite(result)) {
+        return false;
+    }
+    *out = result;
+    return true;
+}
+
+// Copies a string value, resolving the simple escapes and truncating to size
+static bool copyString(const JsonValue& value, char* out, size_t size) {
+    if (value.type != JSON_STRING || size == 0) {
+        return false;
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < value.length && n + 1 < size; i++) {
+        char c = value.text[i];
+        if (c == '\\' && i + 1 < value.length) {
+            c = value.text[++i];
+            if (c == 'u') {
+                i += 4;
+                c = '?';
+            } else if (c == 'n') {
+                c = '\n';
+            } else if (c == 't') {
+                c = '\t';
+            }
+        }
+        out[n++] = c;
+    }
+    out[n] = '\0';
+    return true;
+}
+
+static void lightFieldCb(const char* key, size_t keyLength, const JsonValue& value, void* ctx) {
+    LightStateFields* fields = (LightStateFields*)ctx;
+    float number;
+    if (keyIs(key, keyLength, "state") && value.type == JSON_STRING) {
+        fields->hasState = true;
+        fields->on = valueIs(value, "ON");
+    } else if (keyIs(key, keyLength, "brightness") && toFloat(value, &number)) {
+        fields->hasBrightness = true;
+        fields->brightness = (int)lrintf(number);
+    } else if (keyIs(key, keyLength, "color_temp") && toFloat(value, &number) && number > 0) {
+        fields->hasColorTemp = true;
+        fields->colorTempMireds = (int)lrintf(number);
+    }
+}
+
+static void hvacFieldCb(const char* key, size_t keyLength, const JsonValue& value, void* ctx) {
+    HvacStateFields* fields = (HvacStateFields*)ctx;
+    if (keyIs(key, keyLength, "hvac_mode")) {
+        fields->hasMode = copyString(value, fields->mode, sizeof(fields->mode)) || fields->hasMode;
+    } else if (keyIs(key, keyLength, "temperature")) {
+        fields->hasTargetTemp = toFloat(value, &fields->targetTemp) || fields->hasTargetTemp;
+    } else if (keyIs(key, keyLength, "current_temperature")) {
+        fields->hasCurrentTemp = toFloat(value, &fields->currentTemp) || fields->hasCurrentTemp;
+    }
+}
+
+bool parseLightState(const char* json, size_t length, LightStateFields* fields) {
+    return scanObject(json, length, lightFieldCb, fields);
+}
+
+bool parseHvacState(const char* json, size_t length, HvacStateFields* fields) {
+    return scanObject(json, length, hvacFieldCb, fields);
+}
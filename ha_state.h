@@ -0,0 +1,37 @@
+#ifndef HA_STATE_H
+#define HA_STATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Field extraction from Home Assistant state payloads. One pass over the
+// JSON text in place: only the fields the UI shows are converted, every
+// other value (attribute lists like hvac_modes or fan_modes, nested
+// objects) is skipped without being stored. Memory use is the result
+// struct, whatever the size of the payload. Fields that are missing or
+// null keep their has* flag false.
+
+struct LightStateFields {
+    bool hasState = false;
+    bool on = false;
+    bool hasBrightness = false;
+    int brightness = 0;             // 0-255, as Home Assistant sends it
+    bool hasColorTemp = false;
+    int colorTempMireds = 0;
+};
+
+struct HvacStateFields {
+    bool hasMode = false;
+    char mode[16] = "";
+    bool hasTargetTemp = false;
+    float targetTemp = 0;
+    bool hasCurrentTemp = false;
+    float currentTemp = 0;
+};
+
+// Both return false if the payload is not a well formed JSON object; the
+// fields found before the error are still filled in.
+bool parseLightState(const char* json, size_t length, LightStateFields* fields);
+bool parseHvacState(const char* json, size_t length, HvacStateFields* fields);
+
+#endif
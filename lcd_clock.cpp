@@ -0,0 +1,147 @@
+#include "lcd_clock.h"
+#include <Preferences.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "soc/soc.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_commands.h"
+#include "log_ring.h"
+#include "esp_lcd_sh8601.h"
+#include "pclk_search.h"
+
+static const char *TAG = "lcd_clock";
+
+#define NVS_NAMESPACE   "lcd"
+#define NVS_KEY_PCLK    "pclk_hz"
+
+#define LCD_CMD_WRDISBV 0x51    // write display brightness
+#define LCD_CMD_RDDISBV 0x52    // read display brightness
+
+#define MAX_RATES 8
+
+// Brightness values written and read back at every step; the display is
+// still off, so none of this is visible
+static const uint8_t testPatterns[] = {0x5A, 0xA5, 0x0F, 0xF0, 0x00, 0xFF};
+
+struct ProbeContext {
+    uint8_t id[3];      // RDDID as read at the default clock
+};
+
+static esp_lcd_panel_io_handle_t openIo(uint32_t hz) {
+    esp_lcd_panel_io_spi_config_t io_config = SH8601_PANEL_IO_QSPI_CONFIG(EXAMPLE_PIN_NUM_LCD_CS, NULL, NULL);
+    io_config.pclk_hz = hz;
+    esp_lcd_panel_io_handle_t io = NULL;
+    if (esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)LCD_HOST, &io_config, &io) != ESP_OK) {
+        return NULL;
+    }
+    return io;
+}
+
+// Registers only answer once the panel is out of reset and sleep
+static void wakePanel(esp_lcd_panel_io_handle_t io) {
+#if EXAMPLE_PIN_NUM_LCD_RST >= 0
+    gpio_config_t io_conf = {};
+    io_conf.pin_bit_mask = 1ULL << EXAMPLE_PIN_NUM_LCD_RST;
+    io_conf.mode = GPIO_MODE_OUTPUT;
+    gpio_config(&io_conf);
+    gpio_set_level((gpio_num_t)EXAMPLE_PIN_NUM_LCD_RST, 0);
+    vTaskDelay(pdMS_TO_TICKS(10));
+    gpio_set_level((gpio_num_t)EXAMPLE_PIN_NUM_LCD_RST, 1);
+    vTaskDelay(pdMS_TO_TICKS(10));
+#endif
+    esp_lcd_sh8601_qspi_tx_param(io, LCD_CMD_SLPOUT, NULL, 0);
+    vTaskDelay(pdMS_TO_TICKS(120));
+}
+
+static bool probeRate(uint32_t hz, void *ctx) {
+    const ProbeContext *probe = (const ProbeContext*)ctx;
+    esp_lcd_panel_io_handle_t io = openIo(hz);
+    if (!io) {
+        return false;
+    }
+
+    uint8_t id[3] = {0};
+    bool ok = esp_lcd_sh8601_qspi_rx_param(io, LCD_CMD_RDDID, id, sizeof(id)) == ESP_OK &&
+              memcmp(id, probe->id, sizeof(id)) == 0;
+    for (size_t i = 0; ok && i < sizeof(testPatterns); i++) {
+        uint8_t readback = ~testPatterns[i];
+        ok = esp_lcd_sh8601_qspi_tx_param(io, LCD_CMD_WRDISBV, &testPatterns[i], 1) == ESP_OK &&
+             esp_lcd_sh8601_qspi_rx_param(io, LCD_CMD_RDDISBV, &readback, 1) == ESP_OK &&
+             readback == testPatterns[i];
+    }
+
+    esp_lcd_panel_io_del(io);
+    return ok;
+}
+
+// The SPI clock is divided down from APB, so several requested rates can
+// end up as the same actual rate; each actual rate is tried once
+static size_t buildRateList(uint32_t *rates) {
+    static const uint32_t candidates[] = LCD_PCLK_TUNE_RATES;
+    size_t count = 0;
+
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]) && count < MAX_RATES; i++) {
+        const uint32_t actual = spi_get_actual_clock(APB_CLK_FREQ, candidates[i], 128);
+        if (count == 0 || actual > rates[count - 1]) {
+            rates[count++] = actual;
+        }
+    }
+    return count;
+}
+
+static uint32_t calibrate(ProbeContext *ctx) {
+    uint32_t rates[MAX_RATES];
+    const size_t count = buildRateList(rates);
+
+    LOG_I(TAG, "Calibrating QSPI clock, %u candidate rates", (unsigned)count);
+    const uint32_t best = pclk_search(rates, count, LCD_PCLK_TUNE_ROUNDS, probeRate, ctx);
+    for (size_t i = 0; i < count; i++) {
+        LOG_I(TAG, "  %u Hz: %s", (unsigned)rates[i], rates[i] <= best ? "stable" : "failed or not tried");
+    }
+    return best;
+}
+
+uint32_t lcdClockSelect() {
+#if LCD_PCLK_AUTOTUNE
+    ProbeContext ctx;
+    esp_lcd_panel_io_handle_t io = openIo(EXAMPLE_LCD_PCLK_HZ);
+    if (!io) {
+        return EXAMPLE_LCD_PCLK_HZ;
+    }
+    wakePanel(io);
+    const bool idRead = esp_lcd_sh8601_qspi_rx_param(io, LCD_CMD_RDDID, ctx.id, sizeof(ctx.id)) == ESP_OK;
+    esp_lcd_panel_io_del(io);
+
+    // Without working readback at the default clock nothing can be verified
+    const bool idValid = idRead && (ctx.id[0] | ctx.id[1] | ctx.id[2]) != 0x00 && (ctx.id[0] & ctx.id[1] & ctx.id[2]) != 0xFF;
+    if (!idValid || !probeRate(EXAMPLE_LCD_PCLK_HZ, &ctx)) {
+        LOG_W(TAG, "Panel readback not working, skipping QSPI clock calibration");
+        return EXAMPLE_LCD_PCLK_HZ;
+    }
+
+    Preferences prefs;
+    prefs.begin(NVS_NAMESPACE, false);
+    uint32_t hz = LCD_PCLK_TUNE_FORCE ? 0 : prefs.getUInt(NVS_KEY_PCLK, 0);
+    // Same number of rounds as a fresh search; one clean probe says little
+    if (hz && pclk_search(&hz, 1, LCD_PCLK_TUNE_ROUNDS, probeRate, &ctx) == hz) {
+        LOG_I(TAG, "Using calibrated QSPI clock %u Hz", (unsigned)hz);
+        prefs.end();
+        return hz;
+    }
+
+    hz = calibrate(&ctx);
+    if (!hz) {
+        hz = EXAMPLE_LCD_PCLK_HZ;
+    }
+    prefs.putUInt(NVS_KEY_PCLK, hz);
+    prefs.end();
+
+    LOG_I(TAG, "QSPI clock calibrated: %u Hz", (unsigned)hz);
+    return hz;
+#else
+    return EXAMPLE_LCD_PCLK_HZ;
+#endif
+}
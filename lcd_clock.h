@@ -0,0 +1,16 @@
+#ifndef LCD_CLOCK_H
+#define LCD_CLOCK_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Picks the QSPI pixel clock for the panel. With LCD_PCLK_AUTOTUNE the
+// fastest rate that survives register readback is found once per unit
+// and kept in NVS; later boots only re-check the stored rate and
+// calibrate again if it stopped working. Readback only exercises
+// single-line command and parameter transfers, never quad pixel writes,
+// so a rate that passes can still corrupt pixel data.
+// Call after the SPI bus is initialized and before the panel IO is created.
+uint32_t lcdClockSelect();
+
+#endif
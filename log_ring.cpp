@@ -0,0 +1,122 @@
+#include "log_ring.h"
+#include <Arduino.h>
+#include <atomic>
+#include <stdarg.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static_assert((LOG_RING_SLOTS & (LOG_RING_SLOTS - 1)) == 0, "LOG_RING_SLOTS must be a power of two");
+static_assert(LOG_LINE_BYTES <= 255, "LOG_LINE_BYTES must fit the record length");
+
+// Bounded multi-producer ring (D. Vyukov's). Each slot carries a sequence
+// number: equal to the write position when the slot is free for it, one
+// more once the line is in. Producers claim a position with a CAS, so
+// none ever waits for another; the drain task is the only consumer.
+struct LogRecord {
+    std::atomic<uint32_t> sequence;
+    uint32_t timeMs;
+    const char *tag;
+    uint8_t level;
+    uint8_t length;
+    char text[LOG_LINE_BYTES];
+};
+
+static LogRecord ring[LOG_RING_SLOTS];
+static std::atomic<uint32_t> writePos{0};
+static uint32_t readPos = 0;                // drain task only
+static std::atomic<uint32_t> written{0};
+static std::atomic<uint32_t> dropped{0};
+static std::atomic<uint32_t> maxBacklog{0};
+
+// Before setup() runs, so lines logged from any init code find the ring ready
+static struct LogRingSetup {
+    LogRingSetup() {
+        for (uint32_t i = 0; i < LOG_RING_SLOTS; i++) {
+            ring[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+} logRingSetup;
+
+void logWrite(uint8_t level, const char *tag, const char *fmt, ...) {
+    uint32_t pos = writePos.load(std::memory_order_relaxed);
+    LogRecord *record;
+    while (true) {
+        record = &ring[pos & (LOG_RING_SLOTS - 1)];
+        const int32_t diff = (int32_t)(record->sequence.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+            if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Still holds the line from one lap ago
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = writePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    va_list args;
+    va_start(args, fmt);
+    const int n = vsnprintf(record->text, sizeof(record->text), fmt, args);
+    va_end(args);
+    record->length = n < 0 ? 0 : n < (int)sizeof(record->text) ? n : sizeof(record->text) - 1;
+    record->timeMs = millis();
+    record->tag = tag;
+    record->level = level;
+    record->sequence.store(pos + 1, std::memory_order_release);
+    written.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void drainTask(void *arg) {
+    static const char LEVEL_CHARS[] = "-EWID";
+    char line[LOG_LINE_BYTES + 48];
+    uint32_t droppedReported = 0;
+
+    while (true) {
+        uint32_t backlog = 0;
+        while (true) {
+            LogRecord &record = ring[readPos & (LOG_RING_SLOTS - 1)];
+            if ((int32_t)(record.sequence.load(std::memory_order_acquire) - (readPos + 1)) < 0) {
+                break;
+            }
+            const char level = LEVEL_CHARS[record.level <= LOG_LEVEL_DEBUG ? record.level : 0];
+            int n = snprintf(line, sizeof(line), "%c (%u) %s: %.*s\n", level, (unsigned)record.timeMs, record.tag,
+                             record.length, record.text);
+            // The slot goes back before the slow write
+            record.sequence.store(readPos + LOG_RING_SLOTS, std::memory_order_release);
+            readPos++;
+            backlog++;
+            if (n >= (int)sizeof(line)) {
+                n = sizeof(line) - 1;
+                line[n - 1] = '\n';
+            }
+            Serial.write((const uint8_t *)line, n);
+        }
+
+        if (backlog > maxBacklog.load(std::memory_order_relaxed)) {
+            maxBacklog.store(backlog, std::memory_order_relaxed);
+        }
+        const uint32_t lost = dropped.load(std::memory_order_relaxed);
+        if (lost != droppedReported) {
+            Serial.printf("W (%u) log: %u lines dropped\n", (unsigned)millis(), (unsigned)(lost - droppedReported));
+            droppedReported = lost;
+        }
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_MS));
+    }
+}
+
+void logInit() {
+    if (xTaskCreatePinnedToCore(drainTask, "log", LOG_TASK_STACK_SIZE, NULL, LOG_TASK_PRIORITY, NULL,
+                                LOG_TASK_CORE) != pdPASS) {
+        Serial.println("Failed to create log task!");
+    }
+}
+
+LogStats getLogStats() {
+    LogStats stats;
+    stats.written = written.load(std::memory_order_relaxed);
+    stats.dropped = dropped.load(std::memory_order_relaxed);
+    stats.maxBacklog = maxBacklog.load(std::memory_order_relaxed);
+    return stats;
+}
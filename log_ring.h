@@ -0,0 +1,57 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <stdint.h>
+#include "config.h"
+
+// Levelled logging that never waits for the UART. A log call formats its
+// line into a fixed-size record of a lock-free ring that any task can
+// write to, and returns; a low priority task drains the ring to Serial.
+// When the ring is full the line is dropped and counted. Levels above
+// LOG_LEVEL are compiled out, arguments included.
+//
+// Lines are formatted at the call rather than in the drain task because
+// they often print buffers that are gone by then, like the MQTT topic
+// and payload. Lines longer than LOG_LINE_BYTES are cut. Not for ISRs.
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+struct LogStats {
+    uint32_t written = 0;
+    uint32_t dropped = 0;       // ring full
+    uint32_t maxBacklog = 0;    // most lines written out in one drain pass
+};
+
+// Starts the drain task. Lines logged before are kept until it runs.
+void logInit();
+
+void logWrite(uint8_t level, const char *tag, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+LogStats getLogStats();
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(tag, ...) logWrite(LOG_LEVEL_ERROR, tag, __VA_ARGS__)
+#else
+#define LOG_E(tag, ...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(tag, ...) logWrite(LOG_LEVEL_WARN, tag, __VA_ARGS__)
+#else
+#define LOG_W(tag, ...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(tag, ...) logWrite(LOG_LEVEL_INFO, tag, __VA_ARGS__)
+#else
+#define LOG_I(tag, ...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(tag, ...) logWrite(LOG_LEVEL_DEBUG, tag, __VA_ARGS__)
+#else
+#define LOG_D(tag, ...) do {} while (0)
+#endif
+
+#endif
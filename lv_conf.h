@@ -10,15 +10,40 @@
 #define LV_COLOR_DEPTH 16
 #define LV_COLOR_16_SWAP 0
 
-#define LV_MEM_CUSTOM 1
-#define LV_MEM_SIZE (64U * 1024U)
+/* LVGL's own TLSF heap in one pool, allocated by lvglMemPoolAlloc() (lvgl_mem.cpp)
+ * in PSRAM or internal RAM as LVGL_MEM_IN_PSRAM in config.h selects */
+#define LV_MEM_SIZE (128U * 1024U)
 #define LV_MEM_ADR 0
+#define LV_MEM_POOL_ALLOC lvglMemPoolAlloc
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+void *lvglMemPoolAlloc(size_t size);
+void *lvglMemTraceAlloc(size_t size);
+void *lvglMemTraceRealloc(void *ptr, size_t size);
+void lvglMemTraceFree(void *ptr);
+#ifdef __cplusplus
+}
+#endif
+/* 1 prints every LVGL heap call over Serial for tools/tlsf_bench. The heap then
+ * comes from malloc() through lvgl_mem.cpp instead of the TLSF pool. */
+#define LVGL_MEM_TRACE 0
+#if LVGL_MEM_TRACE
+#define LV_MEM_CUSTOM 1
+#define LV_MEM_CUSTOM_ALLOC lvglMemTraceAlloc
+#define LV_MEM_CUSTOM_FREE lvglMemTraceFree
+#define LV_MEM_CUSTOM_REALLOC lvglMemTraceRealloc
+#else
+#define LV_MEM_CUSTOM 0
+#endif
 #define LV_MEM_AUTO_DEFRAG 1
 
 #define LV_TICK_CUSTOM 1
 #define LV_TICK_CUSTOM_INCLUDE "Arduino.h"
 #define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())
-#define LV_DISP_REFR_PERIOD 30
+#define LV_DISP_REFR_PERIOD 30     // active rate without TE, see the refresh governor in config.h
+#define LV_INDEV_DEF_READ_PERIOD 10 // only copies the touch task's latest sample
 
 #define LV_USE_PERF_MONITOR 0
 #define LV_USE_MEM_MONITOR 0
@@ -28,28 +53,28 @@
 #define LV_LOG_LEVEL LV_LOG_LEVEL_WARN
 #define LV_LOG_PRINTF 1
 
-#define LV_FONT_MONTSERRAT_8 1
-#define LV_FONT_MONTSERRAT_10 1
-#define LV_FONT_MONTSERRAT_12 1
-#define LV_FONT_MONTSERRAT_14 1
-#define LV_FONT_MONTSERRAT_16 1
-#define LV_FONT_MONTSERRAT_18 1
-#define LV_FONT_MONTSERRAT_20 1
+#define LV_FONT_MONTSERRAT_8 0
+#define LV_FONT_MONTSERRAT_10 0
+#define LV_FONT_MONTSERRAT_12 0
+#define LV_FONT_MONTSERRAT_14 0
+#define LV_FONT_MONTSERRAT_16 0
+#define LV_FONT_MONTSERRAT_18 0
+#define LV_FONT_MONTSERRAT_20 0
 #define LV_FONT_MONTSERRAT_22 1
-#define LV_FONT_MONTSERRAT_24 1
-#define LV_FONT_MONTSERRAT_26 1
-#define LV_FONT_MONTSERRAT_28 1
-#define LV_FONT_MONTSERRAT_30 1
-#define LV_FONT_MONTSERRAT_32 1
-#define LV_FONT_MONTSERRAT_34 1
-#define LV_FONT_MONTSERRAT_36 1
-#define LV_FONT_MONTSERRAT_38 1
-#define LV_FONT_MONTSERRAT_40 1
-#define LV_FONT_MONTSERRAT_42 1
-#define LV_FONT_MONTSERRAT_44 1
-#define LV_FONT_MONTSERRAT_46 1
+#define LV_FONT_MONTSERRAT_24 0
+#define LV_FONT_MONTSERRAT_26 0
+#define LV_FONT_MONTSERRAT_28 0
+#define LV_FONT_MONTSERRAT_30 0
+#define LV_FONT_MONTSERRAT_32 0
+#define LV_FONT_MONTSERRAT_34 0
+#define LV_FONT_MONTSERRAT_36 0
+#define LV_FONT_MONTSERRAT_38 0
+#define LV_FONT_MONTSERRAT_40 0
+#define LV_FONT_MONTSERRAT_42 0
+#define LV_FONT_MONTSERRAT_44 0
+#define LV_FONT_MONTSERRAT_46 0
 #define LV_FONT_MONTSERRAT_48 1
-#define LV_FONT_MONTSERRAT_72 1
+#define LV_FONT_MONTSERRAT_72 0
 #define LV_FONT_DEFAULT &lv_font_montserrat_22
 
 #define LV_USE_ANIMATION 1
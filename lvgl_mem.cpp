@@ -0,0 +1,93 @@
+#include "lvgl_mem.h"
+#include <Arduino.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "log_ring.h"
+
+static const char *TAG = "lvgl_mem";
+
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+static LvglMemStats stats;
+static bool poolInPsram = false;
+
+// LV_MEM_POOL_ALLOC in lv_conf.h, called once from lv_init()
+extern "C" void *lvglMemPoolAlloc(size_t size) {
+    void *pool = NULL;
+#if LVGL_MEM_IN_PSRAM
+    pool = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    poolInPsram = pool != NULL;
+    if (!pool) {
+        LOG_W(TAG, "No PSRAM for the LVGL heap, using internal RAM");
+    }
+#endif
+    if (!pool) {
+        pool = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (!pool) {
+        // LVGL has no way to run without its heap
+        LOG_E(TAG, "Failed to allocate the %u byte LVGL heap!", (unsigned)size);
+        abort();
+    }
+    return pool;
+}
+
+#if LVGL_MEM_TRACE
+// LV_MEM_CUSTOM_* in lv_conf.h while tracing. Each call becomes a "T" line
+// on Serial that tools/tlsf_bench replays through TLSF on the host. Straight
+// to Serial rather than LOG_*: the log ring drops lines when it fills, and a
+// trace with gaps cannot be replayed.
+extern "C" void *lvglMemTraceAlloc(size_t size) {
+    void *ptr = malloc(size);
+    Serial.printf("T a %p %u\n", ptr, (unsigned)size);
+    return ptr;
+}
+
+extern "C" void *lvglMemTraceRealloc(void *ptr, size_t size) {
+    void *moved = realloc(ptr, size);
+    Serial.printf("T r %p %p %u\n", ptr, moved, (unsigned)size);
+    return moved;
+}
+
+extern "C" void lvglMemTraceFree(void *ptr) {
+    Serial.printf("T f %p\n", ptr);
+    free(ptr);
+}
+#endif
+
+void lvglMemTraceMark(const char *name) {
+#if LVGL_MEM_TRACE
+    Serial.printf("T m %s\n", name);
+#endif
+}
+
+// lv_mem_monitor() walks every block, so it only runs on this timer
+static void sampleTimerCb(lv_timer_t *timer) {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    portENTER_CRITICAL(&statsLock);
+    stats.totalBytes = mon.total_size;
+    stats.freeBytes = mon.free_size;
+    stats.largestFreeBytes = mon.free_biggest_size;
+    stats.fragPct = mon.frag_pct;
+    stats.usedPct = mon.used_pct;
+    stats.inPsram = poolInPsram;
+    if (!stats.minFreeBytes || mon.free_size < stats.minFreeBytes) {
+        stats.minFreeBytes = mon.free_size;
+    }
+    portEXIT_CRITICAL(&statsLock);
+}
+
+void lvglMemInit() {
+    sampleTimerCb(NULL);
+    lv_timer_create(sampleTimerCb, LVGL_MEM_SAMPLE_MS, NULL);
+    LOG_I(TAG, "LVGL heap: %u bytes in %s", (unsigned)stats.totalBytes, poolInPsram ? "PSRAM" : "internal RAM");
+}
+
+LvglMemStats getLvglMemStats() {
+    portENTER_CRITICAL(&statsLock);
+    LvglMemStats copy = stats;
+    portEXIT_CRITICAL(&statsLock);
+    return copy;
+}
@@ -0,0 +1,32 @@
+#ifndef LVGL_MEM_H
+#define LVGL_MEM_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// LVGL heap statistics. LVGL runs its TLSF allocator (constant time
+// alloc and free) inside a single pool that lvglMemPoolAlloc() places
+// when lv_init() runs.
+struct LvglMemStats {
+    uint32_t totalBytes = 0;
+    uint32_t freeBytes = 0;
+    uint32_t minFreeBytes = 0;      // lowest free seen since boot
+    uint32_t largestFreeBytes = 0;  // biggest block a single allocation can get
+    uint8_t fragPct = 0;            // share of free memory outside the largest block
+    uint8_t usedPct = 0;
+    bool inPsram = false;
+};
+
+// Starts sampling the heap every LVGL_MEM_SAMPLE_MS. Call after lv_init(),
+// before the LVGL task runs.
+void lvglMemInit();
+
+// Latest sample, safe to call from any task
+LvglMemStats getLvglMemStats();
+
+// Names a point in the heap trace that LVGL_MEM_TRACE in lv_conf.h prints,
+// tools/tlsf_bench reports the heap there. Does nothing when not tracing,
+// and while tracing the statistics above stay at zero.
+void lvglMemTraceMark(const char *name);
+
+#endif
@@ -1,7 +1,10 @@
 /*******************************************************************************
  * Size: 96 px
  * Bpp: 1
- * Opts: --bpp 1 --size 96 --no-compress --font Montserrat-Black.ttf --range 32-127 --format lvgl -o montserrat_96.c
+ * Opts: tools/font_subset.py --write
+ * Source: lv_font_conv --bpp 1 --size 96 --no-compress --font Montserrat-Black.ttf --range 32-127 --format lvgl -o montserrat_96.c
+ * Subset: +-0123456789
+ * Compression: rle1
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -22,5569 +25,237 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-    0x0,
-
-    /* U+0021 "!" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xe7, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xe1, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8,
-    0x7f, 0xff, 0xfc, 0x3f, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xf0, 0x3f, 0xff, 0xf8, 0x1f, 0xff, 0xfc, 0xf,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0x81, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xc0, 0x3f,
-    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
-    0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x7, 0xff, 0xc0, 0xf, 0xff,
-    0xf8, 0xf, 0xff, 0xfe, 0xf, 0xff, 0xff, 0x87,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xfc,
-    0x1f, 0xff, 0xfc, 0xf, 0xff, 0xfe, 0x1, 0xff,
-    0xfc, 0x0, 0x7f, 0xfc, 0x0, 0xf, 0xf8, 0x0,
-
-    /* U+0022 "\"" */
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0x3f, 0xff,
-    0xe0, 0xff, 0xff, 0x9f, 0xff, 0xf0, 0x7f, 0xff,
-    0xcf, 0xff, 0xf8, 0x3f, 0xff, 0xe7, 0xff, 0xfc,
-    0x1f, 0xff, 0xf3, 0xff, 0xfe, 0xf, 0xff, 0xf9,
-    0xff, 0xff, 0x7, 0xff, 0xfc, 0xff, 0xff, 0x83,
-    0xff, 0xfe, 0x7f, 0xff, 0xc1, 0xff, 0xff, 0x3f,
-    0xff, 0xc0, 0xff, 0xff, 0x9f, 0xff, 0xe0, 0x3f,
-    0xff, 0xcf, 0xff, 0xf0, 0x1f, 0xff, 0xe7, 0xff,
-    0xf8, 0xf, 0xff, 0xf3, 0xff, 0xfc, 0x7, 0xff,
-    0xf9, 0xff, 0xfe, 0x3, 0xff, 0xfc, 0xff, 0xff,
-    0x1, 0xff, 0xfe, 0x7f, 0xff, 0x80, 0xff, 0xff,
-    0x3f, 0xff, 0xc0, 0x7f, 0xff, 0x9f, 0xff, 0xe0,
-    0x3f, 0xff, 0xcf, 0xff, 0xf0, 0x1f, 0xff, 0xe7,
-    0xff, 0xf8, 0xf, 0xff, 0xe0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x3f,
-    0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x3,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80,
-    0x3f, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xf8,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0,
-    0xf, 0xff, 0xf0, 0x7, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xfc, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xc0, 0x1f, 0xff, 0xe0, 0x0, 0x0,
-    0x3, 0xff, 0xfc, 0x1, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xfc, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x3, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x3f,
-    0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x3,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80,
-    0x3f, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xf8,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x1, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xc0, 0x1f, 0xff, 0xe0, 0x0, 0x0,
-    0x3, 0xff, 0xfc, 0x1, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x1f, 0xff,
-    0xc0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0x0, 0x7f, 0xff, 0xfe, 0xff, 0xfc, 0x1, 0xe0,
-    0x7, 0xff, 0xff, 0xef, 0xff, 0xc0, 0x6, 0x0,
-    0x7f, 0xff, 0xfe, 0xff, 0xfc, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x1, 0x80, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0x3, 0xf8, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xe0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfe,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff,
-    0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1f, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff,
-    0x80, 0x0, 0x1f, 0xff, 0xe7, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xfe, 0x1f,
-    0xff, 0xc0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x7,
-    0xff, 0xe0, 0x7f, 0xfe, 0x0, 0x3, 0xff, 0xfc,
-    0x0, 0x0, 0x3f, 0xff, 0x3, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xf0, 0xf,
-    0xff, 0xc0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0x80, 0x7f, 0xfe, 0x0, 0x1f, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xfc, 0x3, 0xff, 0xf0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x1f,
-    0xff, 0x80, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0xff, 0xfc, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x1, 0xff, 0xf8, 0x7, 0xff, 0xe0, 0xf,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x3f,
-    0xff, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f,
-    0xfe, 0x1, 0xff, 0xf8, 0x7, 0xff, 0xf8, 0x0,
-    0x0, 0x3, 0xff, 0xf0, 0xf, 0xff, 0xc0, 0x7f,
-    0xff, 0x80, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x7f,
-    0xfe, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f,
-    0xfe, 0x7, 0xff, 0xe0, 0x3f, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xf0, 0x3f, 0xff, 0x3, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc3, 0xff,
-    0xf8, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x3f, 0xff, 0xc1, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xe1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0xf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe,
-    0xf, 0xff, 0xf0, 0x3, 0xff, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0xff, 0xff, 0x80, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x7, 0xff, 0xf8,
-    0x1f, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xe0,
-    0x7f, 0xff, 0x81, 0xff, 0xff, 0xf8, 0x0, 0x3,
-    0xff, 0xfc, 0x7, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x3, 0xff, 0x0, 0x3f, 0xff, 0xc1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x1f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfe, 0xf, 0xff, 0xf3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x7f,
-    0xff, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x3, 0xff, 0xf0, 0x3f, 0xff, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf0, 0x1f, 0xff, 0x81, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x81, 0xff,
-    0xf8, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
-    0xf8, 0xf, 0xff, 0xc0, 0x3f, 0xff, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x80, 0x7f, 0xfe, 0x1, 0xff,
-    0xf8, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x3, 0xff,
-    0xf0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0xc0, 0x1f, 0xff, 0x80, 0x7f, 0xfe, 0x0, 0x0,
-    0x3, 0xff, 0xfc, 0x0, 0xff, 0xfc, 0x3, 0xff,
-    0xf0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x7, 0xff,
-    0xe0, 0x1f, 0xff, 0x80, 0x0, 0x1, 0xff, 0xfe,
-    0x0, 0x3f, 0xff, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x1f, 0xff, 0xe0, 0x1, 0xff, 0xf8, 0x7, 0xff,
-    0xe0, 0x0, 0x0, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xc0, 0x3f, 0xff, 0x0, 0x0, 0xf, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0x3, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0x0, 0x1, 0xff, 0xf8, 0x1f, 0xff,
-    0x80, 0x0, 0x7, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe1, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0x9f, 0xff, 0xe0, 0x0, 0x7,
-    0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3f,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x1, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xfe, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x1, 0xff, 0xff, 0xe0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x7f,
-    0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x3,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x81, 0x80, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xc0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xff, 0xc0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xf8, 0x7, 0xff, 0xc0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xc0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfe,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xe0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xfe, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe,
-    0x0, 0xe, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xff,
-    0xfd, 0xff, 0xff, 0x7f, 0xff, 0xdf, 0xff, 0xf7,
-    0xff, 0xfd, 0xff, 0xff, 0x7f, 0xff, 0xdf, 0xff,
-    0xe7, 0xff, 0xf9, 0xff, 0xfe, 0x7f, 0xff, 0x9f,
-    0xff, 0xe7, 0xff, 0xf9, 0xff, 0xfe, 0x7f, 0xff,
-    0x9f, 0xff, 0xe7, 0xff, 0xf9, 0xff, 0xfe, 0x7f,
-    0xff, 0x80,
-
-    /* U+0028 "(" */
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xff, 0x0, 0x1f, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0xc0, 0x3, 0xff, 0xff, 0xe0, 0x1, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0xff,
-    0xff, 0xf8, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0x80, 0x7,
-    0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0x80,
-    0x7, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xfe,
-    0x0, 0x1f, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x1f, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0x80, 0x7, 0xff, 0xff, 0xc0, 0x3, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x7f,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0x80, 0x7,
-    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xe0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0x80, 0x7, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0x7f, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x7, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xe0,
-
-    /* U+0029 ")" */
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x1f, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x3, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x7f,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x7, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x1f, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0x80, 0x7, 0xff, 0xff, 0xc0, 0x3, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xf8, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x7, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xe0, 0x1, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x7f,
-    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x3f,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x30, 0xf, 0xff, 0x80,
-    0xc0, 0x7, 0xc0, 0xff, 0xf8, 0x1e, 0x0, 0x7f,
-    0xf, 0xff, 0x87, 0xf0, 0xf, 0xf8, 0xff, 0xf9,
-    0xff, 0x0, 0xff, 0xef, 0xff, 0xbf, 0xf8, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-    0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xfe, 0xff,
-    0xfb, 0xff, 0x80, 0xff, 0x8f, 0xff, 0x9f, 0xf0,
-    0x7, 0xf0, 0xff, 0xf8, 0x7f, 0x0, 0x7c, 0xf,
-    0xff, 0x83, 0xe0, 0x3, 0x0, 0xff, 0xf8, 0xc,
-    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x80, 0x0,
-
     /* U+002B "+" */
-    0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x7f, 0x0, 0x1, 0xff, 0xf0, 0x3, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0x83, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xe0, 0x7f, 0xff, 0xf0, 0xf, 0xff, 0xf0,
-    0x7, 0xff, 0xf8, 0x3, 0xff, 0xf8, 0x3, 0xff,
-    0xfc, 0x1, 0xff, 0xfe, 0x0, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0x0, 0x7f, 0xff, 0x0, 0x3f, 0xff,
-    0x80, 0x1f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0xf,
-    0xff, 0xc0, 0x7, 0xff, 0xe0, 0x7, 0xff, 0xe0,
-    0x3, 0xff, 0xf0, 0x1, 0xff, 0xf0, 0x0, 0xff,
-    0xf8, 0x0,
+    0x10, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20, 0x11,
+    0x20, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20, 0x11,
+    0x20, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20, 0x11,
+    0x20, 0x11, 0x20, 0x11, 0x20, 0x11, 0x10, 0xc1,
+    0x6, 0x10, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20,
+    0x11, 0x20, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20,
+    0x11, 0x20, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20,
+    0x11, 0x20, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20,
+    0x11, 0x10,
 
     /* U+002D "-" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+002E "." */
-    0x0, 0x7f, 0x0, 0x1, 0xff, 0xf0, 0x1, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0x1, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xc0, 0x7f, 0xff, 0xc0, 0x1f, 0xff, 0xc0,
-    0x7, 0xff, 0xc0, 0x0, 0x7f, 0x0, 0x0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xed, 0x3,
 
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x7, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0x9f, 0xff,
-    0xff, 0xc0, 0x1, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xe7,
-    0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xf9, 0xff,
-    0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xe1, 0xff, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xff, 0xf, 0xff, 0xff,
-    0xf0, 0x7, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff,
-    0xc0, 0x7f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff,
-    0x7, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x19, 0xb, 0x2e, 0x14, 0x26, 0x19, 0x22, 0x1d,
+    0x1e, 0x21, 0x1b, 0x23, 0x18, 0x27, 0x15, 0x29,
+    0x13, 0x2b, 0x11, 0x2d, 0x10, 0x2d, 0xf, 0x2f,
+    0xd, 0x31, 0xb, 0x33, 0xa, 0x33, 0x9, 0x35,
+    0x8, 0x35, 0x7, 0x37, 0x6, 0x19, 0x5, 0x19,
+    0x5, 0x19, 0x7, 0x18, 0x5, 0x18, 0x9, 0x18,
+    0x4, 0x17, 0xb, 0x17, 0x4, 0x17, 0xb, 0x17,
+    0x3, 0x17, 0xd, 0x17, 0x2, 0x17, 0xd, 0x17,
+    0x2, 0x17, 0xd, 0x17, 0x2, 0x17, 0xd, 0x17,
+    0x2, 0x16, 0xe, 0x17, 0x1, 0x17, 0xf, 0x2e,
+    0xf, 0x2e, 0xf, 0x2e, 0xf, 0x2e, 0xf, 0x2e,
+    0xf, 0x2e, 0xf, 0x2e, 0xf, 0x2e, 0xf, 0x2e,
+    0xf, 0x2e, 0xf, 0x2e, 0xf, 0x2e, 0xf, 0x2e,
+    0xf, 0x2e, 0xf, 0x17, 0x1, 0x16, 0xe, 0x17,
+    0x2, 0x17, 0xd, 0x17, 0x2, 0x17, 0xd, 0x17,
+    0x2, 0x17, 0xd, 0x17, 0x2, 0x17, 0xd, 0x17,
+    0x3, 0x17, 0xb, 0x17, 0x4, 0x17, 0xb, 0x17,
+    0x4, 0x18, 0x9, 0x18, 0x4, 0x19, 0x7, 0x18,
+    0x6, 0x19, 0x5, 0x19, 0x6, 0x37, 0x7, 0x35,
+    0x8, 0x35, 0x9, 0x33, 0xa, 0x33, 0xb, 0x31,
+    0xd, 0x2f, 0xe, 0x2e, 0x10, 0x2d, 0x11, 0x2b,
+    0x13, 0x29, 0x15, 0x27, 0x18, 0x23, 0x1b, 0x21,
+    0x1e, 0x1d, 0x22, 0x19, 0x26, 0x14, 0x2e, 0xb,
+    0x19,
 
     /* U+0031 "1" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff,
+    0x0, 0xc2, 0x4, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16, 0xc, 0x16, 0xc, 0x16, 0xc, 0x16, 0xc,
+    0x16,
 
     /* U+0032 "2" */
-    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0xf0, 0x3, 0xff, 0xe0, 0x7, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xf0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x3, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x3c, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x2, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x16, 0xe, 0x28, 0x16, 0x21, 0x1c, 0x1c, 0x20,
+    0x18, 0x24, 0x14, 0x27, 0x12, 0x29, 0x10, 0x2c,
+    0xc, 0x2e, 0xb, 0x30, 0xa, 0x31, 0x8, 0x33,
+    0x6, 0x34, 0x5, 0x36, 0x4, 0x36, 0x3, 0x37,
+    0x5, 0x36, 0x6, 0x34, 0x8, 0x12, 0x6, 0x1a,
+    0xa, 0xd, 0xa, 0x19, 0xc, 0xa, 0xc, 0x18,
+    0xe, 0x7, 0xe, 0x17, 0x10, 0x4, 0xf, 0x17,
+    0x12, 0x1, 0x10, 0x17, 0x23, 0x17, 0x23, 0x17,
+    0x22, 0x17, 0x23, 0x17, 0x22, 0x18, 0x22, 0x18,
+    0x21, 0x18, 0x21, 0x19, 0x20, 0x19, 0x20, 0x19,
+    0x20, 0x1a, 0x1e, 0x1b, 0x1e, 0x1b, 0x1e, 0x1b,
+    0x1e, 0x1b, 0x1e, 0x1b, 0x1e, 0x1c, 0x1d, 0x1c,
+    0x1d, 0x1b, 0x1e, 0x1b, 0x1e, 0x1b, 0x1e, 0x1b,
+    0x1e, 0x1b, 0x1e, 0x1b, 0x1e, 0x1b, 0x1e, 0x1b,
+    0x1e, 0x1b, 0x1d, 0x33, 0x6, 0x34, 0x5, 0x35,
+    0x4, 0x36, 0x4, 0x36, 0x4, 0x36, 0x4, 0x36,
+    0x4, 0x36, 0x4, 0x36, 0x4, 0x36, 0x4, 0x36,
+    0x4, 0x36, 0x4, 0x36, 0x4, 0x36, 0x4, 0x36,
+    0x4, 0x36, 0x4, 0x36, 0x4, 0x36,
 
     /* U+0033 "3" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x4, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x3,
-    0x80, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x3, 0xf0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x81, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc1, 0xff, 0xfc, 0x1,
-    0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfc, 0x0, 0x0, 0x0,
+    0x3, 0x32, 0x7, 0x32, 0x7, 0x32, 0x7, 0x32,
+    0x7, 0x32, 0x7, 0x32, 0x7, 0x32, 0x7, 0x32,
+    0x7, 0x32, 0x7, 0x32, 0x7, 0x32, 0x7, 0x32,
+    0x7, 0x32, 0x7, 0x32, 0x7, 0x31, 0x8, 0x30,
+    0x9, 0x2f, 0x21, 0x17, 0x21, 0x17, 0x21, 0x17,
+    0x21, 0x17, 0x21, 0x17, 0x21, 0x17, 0x21, 0x17,
+    0x21, 0x17, 0x21, 0x17, 0x21, 0x19, 0x20, 0x1c,
+    0x1d, 0x1e, 0x1b, 0x20, 0x19, 0x21, 0x18, 0x22,
+    0x17, 0x23, 0x16, 0x24, 0x15, 0x25, 0x14, 0x25,
+    0x14, 0x26, 0x13, 0x26, 0x13, 0x27, 0x12, 0x27,
+    0x12, 0x27, 0x1f, 0x1b, 0x21, 0x18, 0x21, 0x18,
+    0x22, 0x17, 0x22, 0x17, 0x7, 0x1, 0x1a, 0x17,
+    0x7, 0x3, 0x18, 0x17, 0x6, 0x6, 0x15, 0x18,
+    0x6, 0x9, 0x11, 0x19, 0x5, 0xf, 0x9, 0x1b,
+    0x6, 0x33, 0x5, 0x34, 0x5, 0x33, 0x5, 0x34,
+    0x5, 0x34, 0x4, 0x34, 0x5, 0x33, 0x6, 0x33,
+    0x5, 0x33, 0x6, 0x32, 0x6, 0x32, 0x7, 0x31,
+    0x9, 0x2e, 0xd, 0x2b, 0x10, 0x27, 0x15, 0x22,
+    0x1b, 0x1b, 0x24, 0x10, 0x17,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x80, 0x0,
-    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xe0, 0x0,
-    0xf, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xf8, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xe0,
-    0x0, 0x7f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf8,
-    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfe,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0,
+    0x1c, 0x18, 0x29, 0x18, 0x2a, 0x17, 0x2a, 0x18,
+    0x29, 0x18, 0x2a, 0x17, 0x2a, 0x18, 0x29, 0x18,
+    0x2a, 0x17, 0x2a, 0x18, 0x29, 0x18, 0x2a, 0x17,
+    0x2a, 0x18, 0x29, 0x18, 0x2a, 0x17, 0x2a, 0x18,
+    0x29, 0x18, 0x2a, 0x17, 0x2a, 0x18, 0x29, 0x18,
+    0x2a, 0x17, 0x2a, 0x18, 0x29, 0x18, 0x2a, 0x17,
+    0x2a, 0x18, 0x29, 0x18, 0x29, 0x18, 0x2a, 0x18,
+    0x29, 0x18, 0x2, 0x16, 0x11, 0x18, 0x3, 0x16,
+    0x11, 0x18, 0x3, 0x16, 0x10, 0x18, 0x4, 0x16,
+    0xf, 0x18, 0x5, 0x16, 0xf, 0x18, 0x5, 0x16,
+    0xe, 0x18, 0x6, 0x16, 0xd, 0x19, 0x6, 0x16,
+    0xd, 0x18, 0x7, 0x16, 0xc, 0x18, 0x8, 0x16,
+    0xb, 0x19, 0x8, 0x16, 0xb, 0x40, 0x1, 0x9f,
+    0x8, 0x23, 0x16, 0x2c, 0x16, 0x2c, 0x16, 0x2c,
+    0x16, 0x2c, 0x16, 0x2c, 0x16, 0x2c, 0x16, 0x2c,
+    0x16, 0x2c, 0x16, 0x2c, 0x16, 0x2c, 0x16, 0x2c,
+    0x16, 0x9,
 
     /* U+0035 "5" */
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x4, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x3,
-    0x80, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x3, 0xf0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x81, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc1, 0xff, 0xfc, 0x1,
-    0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfc, 0x0, 0x0, 0x0,
+    0x8, 0x2d, 0xc, 0x2d, 0xb, 0x2e, 0xb, 0x2e,
+    0xb, 0x2e, 0xb, 0x2e, 0xb, 0x2e, 0xb, 0x2e,
+    0xb, 0x2e, 0xb, 0x2e, 0xb, 0x2e, 0xb, 0x2e,
+    0xb, 0x2e, 0xb, 0x2e, 0xb, 0x2e, 0xa, 0x2f,
+    0xa, 0x2f, 0xa, 0x14, 0x25, 0x14, 0x25, 0x14,
+    0x25, 0x14, 0x25, 0x14, 0x25, 0x14, 0x25, 0x14,
+    0x25, 0x1f, 0x1a, 0x24, 0x15, 0x27, 0x11, 0x2a,
+    0xf, 0x2b, 0xe, 0x2d, 0xc, 0x2e, 0xb, 0x2f,
+    0xa, 0x30, 0x9, 0x31, 0x8, 0x31, 0x8, 0x32,
+    0x7, 0x32, 0x7, 0x33, 0x6, 0x33, 0x5, 0x34,
+    0x5, 0x34, 0x1f, 0x1b, 0x20, 0x19, 0x21, 0x18,
+    0x22, 0x17, 0x22, 0x17, 0x7, 0x1, 0x1a, 0x17,
+    0x7, 0x3, 0x18, 0x17, 0x6, 0x6, 0x15, 0x18,
+    0x6, 0x9, 0x11, 0x19, 0x5, 0xf, 0x9, 0x1b,
+    0x6, 0x33, 0x5, 0x34, 0x5, 0x33, 0x5, 0x34,
+    0x5, 0x33, 0x5, 0x34, 0x5, 0x33, 0x6, 0x33,
+    0x5, 0x33, 0x6, 0x32, 0x6, 0x32, 0x7, 0x31,
+    0x9, 0x2e, 0xd, 0x2b, 0x10, 0x27, 0x15, 0x22,
+    0x1b, 0x1b, 0x24, 0x10, 0x17,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x1e, 0x0, 0x1f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x60, 0x1, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x1f,
-    0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0x3,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0x80, 0x7, 0xff, 0xff, 0xe1, 0xff, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xf0, 0x3f, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0,
+    0x1e, 0xe, 0x2a, 0x17, 0x21, 0x1f, 0x1b, 0x23,
+    0x17, 0x27, 0x13, 0x2b, 0x10, 0x2b, 0xf, 0x2c,
+    0xf, 0x2d, 0xe, 0x2d, 0xe, 0x2e, 0xd, 0x2e,
+    0xd, 0x2f, 0xc, 0x2f, 0xc, 0x30, 0xc, 0x2f,
+    0xc, 0x30, 0xc, 0x2f, 0xc, 0x1e, 0x9, 0x9,
+    0xc, 0x1b, 0x10, 0x4, 0xc, 0x1a, 0x14, 0x2,
+    0xc, 0x19, 0x22, 0x19, 0x23, 0x18, 0x24, 0x17,
+    0x24, 0x18, 0x6, 0xb, 0x13, 0x17, 0x4, 0x12,
+    0xf, 0x17, 0x2, 0x16, 0xd, 0x31, 0xb, 0x32,
+    0x9, 0x35, 0x7, 0x36, 0x6, 0x37, 0x5, 0x37,
+    0x5, 0x38, 0x4, 0x39, 0x3, 0x39, 0x3, 0x3a,
+    0x2, 0x3a, 0x2, 0x3b, 0x1, 0x3b, 0x1, 0x1c,
+    0x6, 0x19, 0x1, 0x1b, 0x9, 0x32, 0xb, 0x30,
+    0xc, 0x17, 0x1, 0x17, 0xe, 0x16, 0x1, 0x17,
+    0xe, 0x16, 0x1, 0x17, 0xe, 0x16, 0x1, 0x17,
+    0xe, 0x16, 0x1, 0x17, 0xe, 0x16, 0x2, 0x16,
+    0xe, 0x16, 0x2, 0x17, 0xc, 0x17, 0x2, 0x17,
+    0xc, 0x16, 0x4, 0x17, 0xa, 0x17, 0x4, 0x19,
+    0x6, 0x19, 0x5, 0x37, 0x5, 0x36, 0x7, 0x35,
+    0x8, 0x33, 0x9, 0x32, 0xb, 0x31, 0xc, 0x2f,
+    0xe, 0x2d, 0x10, 0x2b, 0x12, 0x29, 0x15, 0x26,
+    0x17, 0x23, 0x1b, 0x20, 0x1e, 0x1b, 0x24, 0x16,
+    0x2b, 0xd, 0x15,
 
     /* U+0037 "7" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xfe, 0x0, 0xf, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0x80, 0x1f, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xe0, 0x7, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xf8,
-    0x1, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0x3, 0xff, 0xff, 0x80, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xe5, 0x6, 0x1, 0x39, 0x1, 0x39, 0x1,
+    0x38, 0x2, 0x13, 0xd, 0x18, 0x2, 0x13, 0xc,
+    0x18, 0x3, 0x13, 0xc, 0x18, 0x3, 0x13, 0xb,
+    0x19, 0x3, 0x13, 0xb, 0x18, 0x4, 0x13, 0xa,
+    0x19, 0x4, 0x13, 0xa, 0x18, 0x5, 0x13, 0xa,
+    0x18, 0x5, 0x13, 0x9, 0x18, 0x6, 0x13, 0x9,
+    0x18, 0x21, 0x19, 0x21, 0x18, 0x21, 0x19, 0x21,
+    0x18, 0x22, 0x18, 0x21, 0x19, 0x21, 0x18, 0x21,
+    0x19, 0x21, 0x18, 0x21, 0x19, 0x21, 0x19, 0x21,
+    0x18, 0x21, 0x19, 0x21, 0x18, 0x21, 0x19, 0x21,
+    0x18, 0x21, 0x19, 0x21, 0x19, 0x21, 0x18, 0x21,
+    0x19, 0x21, 0x18, 0x21, 0x19, 0x21, 0x19, 0x21,
+    0x18, 0x21, 0x19, 0x21, 0x18, 0x21, 0x19, 0x21,
+    0x18, 0x21, 0x19, 0x21, 0x19, 0x21, 0x18, 0x21,
+    0x19, 0x21, 0x18, 0x21, 0x19, 0x21, 0x19, 0x20,
+    0x19, 0x21, 0x19, 0x21, 0x18, 0x21, 0x19, 0x21,
+    0x19, 0x16,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xf8, 0x0, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0x80, 0xf, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xfc, 0x1,
-    0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x7f,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xf8, 0x1, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0x80, 0x1f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe,
-    0x7, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x18, 0xd, 0x2a, 0x17, 0x22, 0x1d, 0x1d, 0x21,
+    0x19, 0x25, 0x16, 0x27, 0x14, 0x29, 0x11, 0x2d,
+    0xe, 0x2e, 0xe, 0x2f, 0xc, 0x31, 0xa, 0x33,
+    0x9, 0x33, 0x8, 0x35, 0x7, 0x35, 0x7, 0x18,
+    0x5, 0x18, 0x6, 0x18, 0x7, 0x18, 0x5, 0x17,
+    0x9, 0x17, 0x5, 0x16, 0xb, 0x16, 0x5, 0x16,
+    0xb, 0x16, 0x5, 0x16, 0xb, 0x16, 0x5, 0x16,
+    0xb, 0x16, 0x5, 0x16, 0xb, 0x16, 0x5, 0x16,
+    0xb, 0x16, 0x5, 0x17, 0x9, 0x17, 0x6, 0x16,
+    0x9, 0x16, 0x7, 0x17, 0x7, 0x17, 0x7, 0x35,
+    0x8, 0x33, 0x9, 0x32, 0xb, 0x31, 0xc, 0x2f,
+    0xe, 0x2d, 0x10, 0x2b, 0x10, 0x2c, 0xf, 0x2e,
+    0xd, 0x30, 0xb, 0x32, 0x9, 0x34, 0x7, 0x36,
+    0x5, 0x38, 0x4, 0x38, 0x3, 0x1a, 0x6, 0x1a,
+    0x2, 0x18, 0xa, 0x18, 0x2, 0x17, 0xc, 0x17,
+    0x1, 0x18, 0xc, 0x2f, 0xe, 0x2e, 0xe, 0x2e,
+    0xe, 0x2e, 0xe, 0x2e, 0xe, 0x2e, 0xe, 0x2f,
+    0xc, 0x30, 0xc, 0x18, 0x1, 0x18, 0xa, 0x18,
+    0x2, 0x1a, 0x6, 0x1a, 0x2, 0x3a, 0x3, 0x38,
+    0x4, 0x38, 0x5, 0x36, 0x6, 0x35, 0x8, 0x34,
+    0x9, 0x32, 0xb, 0x30, 0xd, 0x2e, 0x10, 0x2a,
+    0x13, 0x28, 0x16, 0x24, 0x1b, 0x1e, 0x21, 0x18,
+    0x28, 0xf, 0x17,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x87,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x3, 0xff, 0x80, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0x7,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0xf8,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0xf, 0xf8,
-    0x3, 0xff, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x0, 0x7f, 0x0, 0x1, 0xff, 0xf0, 0x1, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0x81, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xc0, 0x7f, 0xff, 0xc0, 0x1f, 0xff, 0xc0,
-    0x7, 0xff, 0xc0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc,
-    0x0, 0x7, 0xff, 0xc0, 0x7, 0xff, 0xf0, 0xf,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0x7, 0xff, 0xff, 0x1,
-    0xff, 0xff, 0x0, 0x7f, 0xff, 0x0, 0x1f, 0xff,
-    0x0, 0x1, 0xfc, 0x0,
-
-    /* U+003B ";" */
-    0x0, 0x7f, 0x0, 0x1, 0xff, 0xf0, 0x1, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0x81, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xc0, 0x7f, 0xff, 0xc0, 0x1f, 0xff, 0xc0,
-    0x7, 0xff, 0xc0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc,
-    0x0, 0x7, 0xff, 0xc0, 0xf, 0xff, 0xf0, 0xf,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0x87, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0x87, 0xff, 0xff, 0x81,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xc0, 0x1f, 0xff,
-    0xe0, 0xf, 0xff, 0xe0, 0xf, 0xff, 0xf0, 0x7,
-    0xff, 0xf8, 0x3, 0xff, 0xf8, 0x3, 0xff, 0xfc,
-    0x1, 0xff, 0xfc, 0x0, 0xff, 0xfe, 0x0, 0x7f,
-    0xfe, 0x0, 0x7f, 0xff, 0x0, 0x3f, 0xff, 0x0,
-    0x1f, 0xff, 0x80, 0x1f, 0xff, 0x80, 0xf, 0xff,
-    0xc0, 0x7, 0xff, 0xc0, 0x3, 0xff, 0xe0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0,
-
-    /* U+003E ">" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff,
-    0xff, 0x3, 0xff, 0xff, 0xff, 0x1, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x3f, 0xe0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0xf, 0xc0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x3, 0x80, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x80, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xc0, 0x1, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xfc, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xe0, 0x3, 0xff,
-    0xf8, 0x3f, 0xff, 0xf3, 0xff, 0xf8, 0x1, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xf8, 0xff, 0xff, 0xc7,
-    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x1, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xf, 0xff, 0xc0, 0x3f, 0xff,
-    0xe0, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xfc, 0x3f,
-    0xff, 0x80, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x7f, 0xfe, 0x7, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xfc, 0x1f, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3, 0xff, 0xf0, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7, 0xff,
-    0xc3, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1f, 0xff, 0x8f, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xfe,
-    0x7f, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xf9, 0xff, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3, 0xff, 0xe7,
-    0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xf, 0xff, 0x9f, 0xff, 0xc0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0x7f,
-    0xff, 0x3, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-    0x0, 0x7f, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0x80, 0x7f, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xfe,
-    0x7, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0xe0,
-    0x7f, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xf0, 0x7,
-    0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xfe, 0x7,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0x0, 0x7f,
-    0xff, 0xff, 0xf8, 0x1f, 0xff, 0xfc, 0x0, 0xf,
-    0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x7f,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xf0, 0x7, 0xff,
-    0xff, 0xff, 0x81, 0xff, 0xff, 0xc0, 0x0, 0xff,
-    0xff, 0xc0, 0x1f, 0xff, 0xff, 0xfe, 0x7, 0xff,
-    0xff, 0x0, 0x3, 0xff, 0xff, 0x0, 0x7f, 0xfb,
-    0xff, 0xf8, 0x1f, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xfc, 0x3, 0xff, 0xef, 0xff, 0xe0, 0x7f, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0xf0, 0xf, 0xff, 0xbf,
-    0xff, 0xc0, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff,
-    0xc0, 0x3f, 0xfe, 0x7f, 0xff, 0x3, 0xff, 0xff,
-    0xe0, 0x1f, 0xff, 0xff, 0x1, 0xff, 0xf9, 0xff,
-    0xfc, 0xf, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe,
-    0x7, 0xff, 0xc7, 0xff, 0xf0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x1f, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7f, 0xff, 0x81, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xfe,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x1f, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xe7,
-    0xff, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xfc, 0x3,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xf8, 0x7, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xf0, 0x7,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0x7f, 0xff, 0xe0, 0xf, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xc0, 0xf,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x1,
-    0xff, 0xff, 0x80, 0x7, 0xfc, 0x0, 0x0, 0x3f,
-    0xf0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x80, 0x3, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xe0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x1f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x3, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x81,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0,
-
-    /* U+0042 "B" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xc0,
-    0x0, 0x1f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf0,
-    0x0, 0x3, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xc0, 0x0, 0xf, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xf0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0x0, 0x3, 0xff, 0xff, 0xfe, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xc0, 0x0, 0x7,
-    0xff, 0xff, 0xfb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xf, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0x80, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x1,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x7, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3f, 0xc0, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x1, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xe, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x40, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x40, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xe, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xc0,
-    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7, 0xfe,
-    0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xe0, 0x1f,
-    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xc0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x9f, 0xff, 0xff, 0x80, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0x80, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+0046 "F" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xfe,
-    0x0, 0x7, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x7f, 0x0, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xff, 0xf9, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x3, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x87, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xf0, 0x0, 0x1, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0xff, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff,
-    0xfe, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0,
-
-    /* U+0048 "H" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff,
-
-    /* U+0049 "I" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-
-    /* U+004A "J" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x1, 0x80, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x3c, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x7, 0xe0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0xff, 0x0, 0xf, 0xff, 0xff, 0xe0, 0xf,
-    0xfc, 0x0, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
-    0x0,
-
-    /* U+004B "K" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0xf,
-    0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x1f, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xfc, 0x7,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff,
-    0xff, 0xfc, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xfc,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xf0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff,
-
-    /* U+004C "L" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0,
-
-    /* U+004D "M" */
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x87, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1f, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xfc, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xfe, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0x80,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0x80, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x1, 0xff, 0xc0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xe0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf0,
-
-    /* U+004E "N" */
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff,
-    0xff,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xff, 0x81,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
-    0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xe0, 0x0, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xc0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x80, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x80, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x6, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xc0, 0x0,
-
-    /* U+0052 "R" */
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3,
-    0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x7f, 0xf0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x1, 0xe0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x6, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x1, 0x80, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x3e, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x3,
-    0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x7f,
-    0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x7, 0xff,
-    0xe0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xf0, 0x0, 0x1, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
-    0x0,
-
-    /* U+0056 "V" */
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff,
-    0x80, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x7,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xfe,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0x81, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x1,
-    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xe0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xff, 0x80, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0xf8, 0x1, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x1f, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0x80, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe1, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x3f,
-    0xff, 0xfc, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0x1f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0,
-
-    /* U+0058 "X" */
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xc0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0xf,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xfe, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x1f,
-    0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff,
-    0xc0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xff, 0xf8, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-
-    /* U+0059 "Y" */
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff,
-    0xe0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xfe,
-    0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xfe, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+005B "[" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff,
-    0xf0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x1f, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0xe0, 0x3, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-
-    /* U+005C "\\" */
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf0,
-
-    /* U+005D "]" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff,
-    0x80, 0xf, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff,
-    0xf0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x1f, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xfe, 0xff, 0xff, 0x0, 0x0,
-    0xf, 0xff, 0xf3, 0xff, 0xf8, 0x0, 0x0, 0x7f,
-    0xff, 0x9f, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xc3, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xfc, 0x1f, 0xff, 0xe0,
-    0x0, 0x1f, 0xff, 0xe0, 0x7f, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0x3, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xf0, 0x1f, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0x80,
-    0x7f, 0xff, 0x80, 0x7, 0xff, 0xf8, 0x3, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xc0, 0xf, 0xff, 0xf0,
-    0x3, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0x80, 0x1f,
-    0xff, 0xe0, 0x3, 0xff, 0xfe, 0x0, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0x80, 0x7f, 0xff, 0x80, 0x1, 0xff,
-    0xfe, 0x7, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xf0,
-    0x3f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xc3, 0xff,
-    0xfe, 0x0, 0x1, 0xff, 0xfe, 0x1f, 0xff, 0xe0,
-    0x0, 0xf, 0xff, 0xf8, 0xff, 0xff, 0x0, 0x0,
-    0x3f, 0xff, 0xcf, 0xff, 0xf0, 0x0, 0x1, 0xff,
-    0xfe, 0x7f, 0xff, 0x80, 0x0, 0x7, 0xff, 0xf8,
-
-    /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff,
-
-    /* U+0060 "`" */
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xfc,
-    0x0, 0x3, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xc0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x7, 0xff,
-    0xf8, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0xff, 0xfc,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x1, 0xff, 0x80,
-    0x3f, 0xff, 0xff, 0xf8, 0x3, 0xf8, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x3, 0x80, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x4, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xfe, 0x1f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xfe,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0062 "b" */
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x83, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xf0, 0x1, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
-    0x0, 0xf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xf0, 0x1, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0x80, 0x3f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfe,
-    0xf, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0x83,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x1f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xe0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xc0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x7, 0x80, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0x1, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0,
-    0x1, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0xfc, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0xff,
-    0x80, 0xf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xfe, 0x1,
-    0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0x80, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xfc, 0x1, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf0,
-    0x0, 0x7f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfe, 0xf,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xf,
-    0xfe, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0x80, 0x1f, 0xff, 0xff, 0x87, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf8,
-    0x0, 0x1f, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x0,
-    0x1, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xfc, 0xff, 0xff, 0xf0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xc,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x3, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0x1, 0xff, 0x80, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x80, 0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xc1,
-    0x80, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x80, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x80, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xf0, 0x3,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x80, 0x3f,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xfc, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xc0,
-    0xf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x81,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfc, 0x0,
-    0x7f, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xe0, 0x1,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0x80, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe0, 0x2, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x1c, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf8, 0x1, 0xf8, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0xf, 0xf8, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xc0, 0x0, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0xf, 0xfc,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xfe, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0xff,
-
-    /* U+0069 "i" */
-    0x0, 0x7f, 0x80, 0x0, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0xc0, 0x7f, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xf9, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xe0, 0x3f, 0xff,
-    0xf0, 0x3, 0xff, 0xf0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xf, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xf, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xf, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xf, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xf, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xf0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x3f,
-    0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x1f,
-    0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x18, 0x3f, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xff, 0xfe, 0x3, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff,
-    0x81, 0xff, 0xff, 0xff, 0xfc, 0x7, 0xff, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0x80, 0xff,
-    0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff,
-    0xfc, 0x1, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xff,
-
-    /* U+006C "l" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+006D "m" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0xff, 0xff, 0x80, 0x3, 0xff,
-    0xff, 0xe1, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0x80, 0x3f, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7, 0xff,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff,
-    0x80, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xc0,
-
-    /* U+006E "n" */
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x3f,
-    0xff, 0xfe, 0x3, 0xff, 0xfe, 0x0, 0xf, 0xff,
-    0xff, 0x83, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xf0,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff,
-    0xe7, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xc0, 0x1,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xfc, 0x1, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xe0, 0x0, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0x9f, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x3, 0xff, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xc0, 0x1,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xfc, 0x1, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff,
-    0xe0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xf8,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf8,
-
-    /* U+0072 "r" */
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x3f, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xc0, 0x7f, 0xff,
-    0xf8, 0x0, 0x3, 0xf0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x1e, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x80, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x81,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x30, 0x0,
-    0x0, 0x1f, 0xff, 0xfe, 0xf, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc1, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xf8, 0x7f, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x80, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f,
-    0xff, 0xff, 0x80, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x80, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0xe, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0,
-
-    /* U+0075 "u" */
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0x0, 0x7, 0xff, 0xfc, 0x7, 0xff, 0xff,
-    0xc0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0076 "v" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0xfe,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xe0,
-    0x7, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xe0,
-    0x7, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xfc, 0x1f, 0xff, 0xfe, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0xfe, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x7f, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x7f, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x7f, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xc0,
-    0x0, 0xf, 0xff, 0xfe, 0xff, 0xff, 0xf0, 0x0,
-    0x3, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xfd,
-    0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0x3f, 0xff, 0xf9, 0xff, 0xff, 0xe0, 0x0,
-    0x1f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xe3,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xfe, 0x0,
-    0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0x80, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xfe, 0xf, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xf0, 0x1f, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xe0, 0x3f,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x1,
-    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0x0, 0x7f,
-    0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xc0, 0xf,
-    0xff, 0xfe, 0x0, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0x80, 0x1f, 0xff, 0xfc, 0x1, 0xff,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x3f,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xff, 0xff, 0x0, 0xff, 0xff, 0xe0, 0x3, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xff, 0xfc, 0x3, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xff, 0x81, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xfc, 0x0, 0x1f, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
-    0xc0, 0x0, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xf9, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0x81, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xfe, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xf0, 0xf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x80, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0x81,
-    0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xfe, 0x1,
-    0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xfc, 0x1,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xfe, 0xf, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xfc, 0xf, 0xff,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xf0, 0x1f, 0xff, 0xff, 0xc0, 0x1f, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0x80, 0x1f, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0,
-
-    /* U+0079 "y" */
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0xfe,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xe0,
-    0x7, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xfc, 0x1f, 0xff, 0xfe, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x7f, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x7f, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x80, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xe0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x1, 0xf8, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x3f,
-    0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff,
-    0xff, 0xc0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xfc, 0x1, 0xff,
-    0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3,
-    0xff, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xc0, 0xf,
-    0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x3f,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xfc, 0x1, 0xff,
-    0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xc0,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xc0,
-
-    /* U+007C "|" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0,
-
-    /* U+007D "}" */
-    0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff,
-    0xe0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xfc,
-    0x3, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x3, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xe0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xfc,
-    0x1, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x1, 0xff,
-    0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0x7, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff,
-    0xff, 0xfc, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x1, 0xff,
-    0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x3f, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xfc,
-    0x3, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x7, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xe0, 0x0, 0x1f, 0xff, 0x0, 0xff, 0xff,
-    0x80, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0x3, 0xff, 0xff, 0xf8, 0x3, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xf,
-    0xff, 0xff, 0xff, 0xf, 0xff, 0xf1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xfc, 0x3, 0xff, 0xff, 0xfe, 0xf, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xc0, 0xff, 0xf8, 0x0,
-    0x7f, 0xff, 0xf8, 0xf, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0x0, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0
+    0x15, 0xd, 0x2b, 0x16, 0x24, 0x1b, 0x1e, 0x20,
+    0x1b, 0x23, 0x17, 0x26, 0x15, 0x29, 0x12, 0x2b,
+    0x10, 0x2d, 0xe, 0x2f, 0xc, 0x31, 0xb, 0x32,
+    0x9, 0x33, 0x8, 0x35, 0x7, 0x36, 0x5, 0x37,
+    0x5, 0x19, 0x6, 0x19, 0x4, 0x17, 0xa, 0x17,
+    0x4, 0x16, 0xc, 0x17, 0x2, 0x17, 0xc, 0x17,
+    0x2, 0x16, 0xe, 0x16, 0x2, 0x16, 0xe, 0x17,
+    0x1, 0x16, 0xe, 0x17, 0x1, 0x16, 0xe, 0x17,
+    0x1, 0x16, 0xe, 0x17, 0x1, 0x16, 0xe, 0x17,
+    0x1, 0x17, 0xc, 0x30, 0xb, 0x32, 0xa, 0x1a,
+    0x1, 0x19, 0x6, 0x1c, 0x1, 0x3b, 0x1, 0x3b,
+    0x2, 0x3a, 0x2, 0x3a, 0x3, 0x39, 0x3, 0x39,
+    0x4, 0x38, 0x5, 0x37, 0x5, 0x37, 0x6, 0x36,
+    0x7, 0x35, 0x9, 0x32, 0xb, 0x1a, 0x1, 0x16,
+    0xd, 0x16, 0x2, 0x17, 0xf, 0x12, 0x4, 0x17,
+    0x13, 0xb, 0x7, 0x17, 0x24, 0x17, 0x25, 0x17,
+    0x24, 0x18, 0x23, 0x18, 0x23, 0x19, 0xc, 0x3,
+    0x13, 0x19, 0xc, 0x5, 0x10, 0x1b, 0xc, 0x9,
+    0x9, 0x1d, 0xc, 0x30, 0xc, 0x2f, 0xc, 0x2f,
+    0xd, 0x2f, 0xc, 0x2f, 0xd, 0x2e, 0xd, 0x2e,
+    0xe, 0x2d, 0xe, 0x2d, 0xf, 0x2c, 0xf, 0x2b,
+    0x11, 0x2a, 0x12, 0x28, 0x16, 0x24, 0x1b, 0x1f,
+    0x20, 0x18, 0x29, 0xe, 0x1f
 };
 
 
@@ -5594,101 +265,18 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 461, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1, .adv_w = 482, .box_w = 25, .box_h = 69, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 217, .adv_w = 751, .box_w = 41, .box_h = 29, .ofs_x = 3, .ofs_y = 39},
-    {.bitmap_index = 366, .adv_w = 1137, .box_w = 68, .box_h = 69, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 953, .adv_w = 1009, .box_w = 60, .box_h = 91, .ofs_x = 1, .ofs_y = -12},
-    {.bitmap_index = 1636, .adv_w = 1409, .box_w = 85, .box_h = 70, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 2380, .adv_w = 1193, .box_w = 69, .box_h = 71, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 2993, .adv_w = 390, .box_w = 18, .box_h = 29, .ofs_x = 3, .ofs_y = 39},
-    {.bitmap_index = 3059, .adv_w = 585, .box_w = 33, .box_h = 91, .ofs_x = 5, .ofs_y = -19},
-    {.bitmap_index = 3435, .adv_w = 585, .box_w = 33, .box_h = 91, .ofs_x = -1, .ofs_y = -19},
-    {.bitmap_index = 3811, .adv_w = 727, .box_w = 44, .box_h = 40, .ofs_x = 0, .ofs_y = 31},
-    {.bitmap_index = 4031, .adv_w = 952, .box_w = 49, .box_h = 48, .ofs_x = 5, .ofs_y = 10},
-    {.bitmap_index = 4325, .adv_w = 467, .box_w = 25, .box_h = 39, .ofs_x = 2, .ofs_y = -15},
-    {.bitmap_index = 4447, .adv_w = 599, .box_w = 29, .box_h = 17, .ofs_x = 4, .ofs_y = 20},
-    {.bitmap_index = 4509, .adv_w = 467, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 4588, .adv_w = 676, .box_w = 51, .box_h = 92, .ofs_x = -4, .ofs_y = -10},
-    {.bitmap_index = 5175, .adv_w = 1063, .box_w = 61, .box_h = 71, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 5717, .adv_w = 642, .box_w = 34, .box_h = 68, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6006, .adv_w = 934, .box_w = 58, .box_h = 69, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6507, .adv_w = 943, .box_w = 57, .box_h = 69, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6999, .adv_w = 1094, .box_w = 66, .box_h = 68, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7560, .adv_w = 951, .box_w = 57, .box_h = 69, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 8052, .adv_w = 1015, .box_w = 60, .box_h = 71, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 8585, .adv_w = 991, .box_w = 58, .box_h = 68, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9078, .adv_w = 1041, .box_w = 60, .box_h = 71, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 9611, .adv_w = 1015, .box_w = 60, .box_h = 71, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 10144, .adv_w = 467, .box_w = 25, .box_h = 55, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 10316, .adv_w = 467, .box_w = 25, .box_h = 69, .ofs_x = 2, .ofs_y = -15},
-    {.bitmap_index = 10532, .adv_w = 952, .box_w = 49, .box_h = 54, .ofs_x = 5, .ofs_y = 7},
-    {.bitmap_index = 10863, .adv_w = 952, .box_w = 49, .box_h = 42, .ofs_x = 5, .ofs_y = 13},
-    {.bitmap_index = 11121, .adv_w = 952, .box_w = 49, .box_h = 54, .ofs_x = 5, .ofs_y = 7},
-    {.bitmap_index = 11452, .adv_w = 931, .box_w = 56, .box_h = 71, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 11949, .adv_w = 1593, .box_w = 94, .box_h = 89, .ofs_x = 3, .ofs_y = -20},
-    {.bitmap_index = 12995, .adv_w = 1238, .box_w = 81, .box_h = 68, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 13684, .adv_w = 1187, .box_w = 66, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 14245, .adv_w = 1132, .box_w = 68, .box_h = 71, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 14849, .adv_w = 1269, .box_w = 71, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 15453, .adv_w = 1034, .box_w = 56, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 15929, .adv_w = 989, .box_w = 55, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 16397, .adv_w = 1181, .box_w = 69, .box_h = 71, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 17010, .adv_w = 1235, .box_w = 66, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 17571, .adv_w = 538, .box_w = 22, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 17758, .adv_w = 882, .box_w = 52, .box_h = 69, .ofs_x = -2, .ofs_y = -2},
-    {.bitmap_index = 18207, .adv_w = 1175, .box_w = 70, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 18802, .adv_w = 948, .box_w = 53, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 19253, .adv_w = 1465, .box_w = 81, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 19942, .adv_w = 1235, .box_w = 66, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 20503, .adv_w = 1303, .box_w = 76, .box_h = 71, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 21178, .adv_w = 1141, .box_w = 63, .box_h = 68, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 21714, .adv_w = 1303, .box_w = 80, .box_h = 86, .ofs_x = 3, .ofs_y = -17},
-    {.bitmap_index = 22574, .adv_w = 1144, .box_w = 64, .box_h = 67, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 23110, .adv_w = 1009, .box_w = 60, .box_h = 71, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 23643, .adv_w = 1005, .box_w = 62, .box_h = 68, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24170, .adv_w = 1204, .box_w = 65, .box_h = 70, .ofs_x = 5, .ofs_y = -2},
-    {.bitmap_index = 24739, .adv_w = 1207, .box_w = 79, .box_h = 68, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 25411, .adv_w = 1852, .box_w = 114, .box_h = 68, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26380, .adv_w = 1170, .box_w = 75, .box_h = 68, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 27018, .adv_w = 1091, .box_w = 72, .box_h = 68, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 27630, .adv_w = 1055, .box_w = 62, .box_h = 68, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 28157, .adv_w = 630, .box_w = 33, .box_h = 91, .ofs_x = 5, .ofs_y = -19},
-    {.bitmap_index = 28533, .adv_w = 676, .box_w = 51, .box_h = 92, .ofs_x = -5, .ofs_y = -10},
-    {.bitmap_index = 29120, .adv_w = 630, .box_w = 33, .box_h = 91, .ofs_x = 1, .ofs_y = -19},
-    {.bitmap_index = 29496, .adv_w = 952, .box_w = 53, .box_h = 41, .ofs_x = 3, .ofs_y = 13},
-    {.bitmap_index = 29768, .adv_w = 768, .box_w = 48, .box_h = 11, .ofs_x = 0, .ofs_y = -12},
-    {.bitmap_index = 29834, .adv_w = 922, .box_w = 33, .box_h = 15, .ofs_x = 6, .ofs_y = 59},
-    {.bitmap_index = 29896, .adv_w = 982, .box_w = 55, .box_h = 55, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 30275, .adv_w = 1075, .box_w = 60, .box_h = 73, .ofs_x = 5, .ofs_y = -1},
-    {.bitmap_index = 30823, .adv_w = 945, .box_w = 57, .box_h = 55, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 31215, .adv_w = 1083, .box_w = 61, .box_h = 73, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 31772, .adv_w = 1003, .box_w = 59, .box_h = 55, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 32178, .adv_w = 654, .box_w = 43, .box_h = 73, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 32571, .adv_w = 1092, .box_w = 61, .box_h = 74, .ofs_x = 2, .ofs_y = -20},
-    {.bitmap_index = 33136, .adv_w = 1078, .box_w = 58, .box_h = 72, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 33658, .adv_w = 501, .box_w = 26, .box_h = 79, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 33915, .adv_w = 513, .box_w = 38, .box_h = 99, .ofs_x = -9, .ofs_y = -20},
-    {.bitmap_index = 34386, .adv_w = 1077, .box_w = 64, .box_h = 72, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 34962, .adv_w = 501, .box_w = 22, .box_h = 72, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 35160, .adv_w = 1597, .box_w = 91, .box_h = 54, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 35775, .adv_w = 1078, .box_w = 58, .box_h = 54, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 36167, .adv_w = 1041, .box_w = 61, .box_h = 55, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 36587, .adv_w = 1075, .box_w = 60, .box_h = 73, .ofs_x = 5, .ofs_y = -19},
-    {.bitmap_index = 37135, .adv_w = 1075, .box_w = 61, .box_h = 73, .ofs_x = 2, .ofs_y = -19},
-    {.bitmap_index = 37692, .adv_w = 700, .box_w = 38, .box_h = 54, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 37949, .adv_w = 868, .box_w = 51, .box_h = 55, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 38300, .adv_w = 707, .box_w = 43, .box_h = 66, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 38655, .adv_w = 1072, .box_w = 58, .box_h = 54, .ofs_x = 5, .ofs_y = -1},
-    {.bitmap_index = 39047, .adv_w = 989, .box_w = 64, .box_h = 53, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 39471, .adv_w = 1501, .box_w = 95, .box_h = 53, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 40101, .adv_w = 991, .box_w = 63, .box_h = 53, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 40519, .adv_w = 989, .box_w = 64, .box_h = 73, .ofs_x = -1, .ofs_y = -20},
-    {.bitmap_index = 41103, .adv_w = 876, .box_w = 50, .box_h = 53, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 41435, .adv_w = 673, .box_w = 38, .box_h = 91, .ofs_x = 4, .ofs_y = -19},
-    {.bitmap_index = 41868, .adv_w = 492, .box_w = 20, .box_h = 91, .ofs_x = 5, .ofs_y = -19},
-    {.bitmap_index = 42096, .adv_w = 673, .box_w = 37, .box_h = 91, .ofs_x = 1, .ofs_y = -19},
-    {.bitmap_index = 42517, .adv_w = 952, .box_w = 52, .box_h = 22, .ofs_x = 4, .ofs_y = 23}
+    {.bitmap_index = 0, .adv_w = 952, .box_w = 49, .box_h = 48, .ofs_x = 5, .ofs_y = 10},
+    {.bitmap_index = 66, .adv_w = 599, .box_w = 29, .box_h = 17, .ofs_x = 4, .ofs_y = 20},
+    {.bitmap_index = 69, .adv_w = 1063, .box_w = 61, .box_h = 71, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 254, .adv_w = 642, .box_w = 34, .box_h = 68, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 359, .adv_w = 934, .box_w = 58, .box_h = 69, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 509, .adv_w = 943, .box_w = 57, .box_h = 69, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 658, .adv_w = 1094, .box_w = 66, .box_h = 68, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 788, .adv_w = 951, .box_w = 57, .box_h = 69, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 937, .adv_w = 1015, .box_w = 60, .box_h = 71, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 1116, .adv_w = 991, .box_w = 58, .box_h = 68, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1246, .adv_w = 1041, .box_w = 60, .box_h = 71, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 1425, .adv_w = 1015, .box_w = 60, .box_h = 71, .ofs_x = 1, .ofs_y = -2}
 };
 
 /*---------------------
@@ -5696,13 +284,16 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
  *--------------------*/
 
 
+static const uint16_t unicode_list_0[] = {
+    0x0, 0x2, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa, 0xb, 0xc, 0xd, 0xe
+};
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+        .range_start = 43, .range_length = 15, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -5738,6 +329,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
 
 extern const lv_font_t lv_font_montserrat_48;
 
+const uint8_t * glyphCacheGetBitmap(const lv_font_t * font, uint32_t letter);
 
 /*-----------------
  *  PUBLIC FONT
@@ -5750,7 +342,7 @@ const lv_font_t montserrat_96 = {
 lv_font_t montserrat_96 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = glyphCacheGetBitmap,           /*Function pointer to get glyph's bitmap*/
     .line_height = 102,          /*The maximum line height required by the font*/
     .base_line = 20,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -1,20 +1,73 @@
 #include "mqtt_handler.h"
 #include "screen_manager.h"
+#include "ui_queue.h"
+#include "perf_monitor.h"
+#include "ha_state.h"
+#include "log_ring.h"
 #include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+
+static const char *TAG = "mqtt";
 
 LightState lightState;
 HVACState hvacState;
 
 MQTTHandler* MQTTHandler::instance = nullptr;
 
+static bool payloadEquals(const char* payload, size_t length, const char* text) {
+    return length == strlen(text) && memcmp(payload, text, length) == 0;
+}
+
+const TopicRoute MQTTHandler::routes[] = {
+    {LIGHT_STATE_TOPIC, MQTTHandler::onLightState, 0},
+    {HVAC_STATE_TOPIC, MQTTHandler::onHVACState, 0},
+    {DIAGNOSTICS_COMMAND_TOPIC, MQTTHandler::onDiagnosticsCommand, 0},
+    {"homeassistant/status", MQTTHandler::onHomeAssistantStatus, 0},
+};
+
 void MQTTHandler::init(PubSubClient* client, ScreenManager* screenMgr) {
     mqttClient = client;
     screenManager = screenMgr;
     instance = this;
     
+    setupReceiveBuffer();
+    if (!router.init(routes, sizeof(routes) / sizeof(routes[0]))) {
+        LOG_E(TAG, "MQTT routes invalid, incoming messages will be ignored");
+    }
     mqttClient->setCallback(messageCallback);
     
-    Serial.println("MQTT Handler initialized");
+    LOG_I(TAG, "MQTT Handler initialized");
+}
+
+// PubSubClient drops any packet larger than its buffer before the callback
+// sees it, and full Home Assistant state documents are well past the
+// default 256 bytes. The buffer lives as long as the client, across
+// reconnects, and is grown with realloc(): the heap puts a buffer this
+// size in PSRAM. The internal RAM it took is checked, not assumed.
+void MQTTHandler::setupReceiveBuffer() {
+    if (psramFound()) {
+        const int internalBefore = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        if (mqttClient->setBufferSize(MQTT_BUFFER_SIZE)) {
+            const int internalUsed = internalBefore - (int)heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+            if (internalUsed < MQTT_BUFFER_SIZE / 2) {
+                rxStats.bufferSize = MQTT_BUFFER_SIZE;
+                rxStats.bufferInPsram = true;
+                LOG_I(TAG, "MQTT buffer: %d bytes in PSRAM", MQTT_BUFFER_SIZE);
+                return;
+            }
+            LOG_W(TAG, "MQTT buffer landed in internal RAM, shrinking it");
+        }
+    }
+    
+    if (mqttClient->setBufferSize(MQTT_BUFFER_SIZE_INTERNAL)) {
+        rxStats.bufferSize = MQTT_BUFFER_SIZE_INTERNAL;
+    } else {
+        rxStats.bufferSize = mqttClient->getBufferSize();
+        LOG_E(TAG, "Failed to grow the MQTT buffer");
+    }
+    LOG_I(TAG, "MQTT buffer: %u bytes in internal RAM", (unsigned)rxStats.bufferSize);
 }
 
 void MQTTHandler::subscribeToTopics() {
@@ -22,17 +75,11 @@ void MQTTHandler::subscribeToTopics() {
         return;
     }
     
-    if (mqttClient->subscribe(LIGHT_STATE_TOPIC)) {
-        Serial.print("Subscribed to light topic: ");
-        Serial.println(LIGHT_STATE_TOPIC);
-    }
-    
-    if (mqttClient->subscribe(HVAC_STATE_TOPIC)) {
-        Serial.print("Subscribed to HVAC topic: ");
-        Serial.println(HVAC_STATE_TOPIC);
+    for (size_t i = 0; i < router.getRouteCount(); i++) {
+        if (mqttClient->subscribe(routes[i].pattern)) {
+            LOG_I(TAG, "Subscribed to: %s", routes[i].pattern);
+        }
     }
-    
-    mqttClient->subscribe("homeassistant/status");
 }
 
 void MQTTHandler::requestStatusUpdate() {
@@ -48,60 +95,58 @@ void MQTTHandler::requestStatusUpdate() {
     hvacRequest["state"] = "";
     sendHVACCommand(hvacRequest);
     
-    Serial.println("Status update requested");
+    LOG_I(TAG, "Status update requested");
 }
 
+enum PendingCommand : uint8_t {
+    PENDING_LIGHT_STATE = 1 << 0,
+    PENDING_BRIGHTNESS = 1 << 1,
+    PENDING_COLOR_TEMP = 1 << 2,
+    PENDING_HVAC_MODE = 1 << 3,
+    PENDING_TEMPERATURE = 1 << 4,
+};
+
+// The UI writes pending commands on the LVGL task, the loop task takes them
+static portMUX_TYPE pendingLock = portMUX_INITIALIZER_UNLOCKED;
+
 void MQTTHandler::setLightState(bool state) {
-    StaticJsonDocument<100> doc;
-    doc["state"] = state ? "ON" : "OFF";
-    sendLightCommand(doc);
-    
-    Serial.print("Light state: ");
-    Serial.println(state ? "ON" : "OFF");
+    portENTER_CRITICAL(&pendingLock);
+    pending.lightOn = state;
+    pending.flags |= PENDING_LIGHT_STATE;
+    if (!state) {
+        pending.flags &= ~(PENDING_BRIGHTNESS | PENDING_COLOR_TEMP);
+    }
+    portEXIT_CRITICAL(&pendingLock);
 }
 
 void MQTTHandler::setLightBrightness(int brightness) {
-    brightness = constrain(brightness, MIN_BRIGHTNESS, MAX_BRIGHTNESS);
-    
-    StaticJsonDocument<100> doc;
-    doc["state"] = "ON";
-    doc["brightness"] = map(brightness, 0, 100, 0, 255);
-    sendLightCommand(doc);
-    
-    Serial.print("Light brightness: ");
-    Serial.println(brightness);
+    portENTER_CRITICAL(&pendingLock);
+    pending.brightness = constrain(brightness, MIN_BRIGHTNESS, MAX_BRIGHTNESS);
+    pending.lightOn = true;
+    pending.flags |= PENDING_BRIGHTNESS;
+    portEXIT_CRITICAL(&pendingLock);
 }
 
 void MQTTHandler::setLightColorTemp(int colorTemp) {
-    colorTemp = constrain(colorTemp, MIN_COLOR_TEMP, MAX_COLOR_TEMP);
-    
-    StaticJsonDocument<150> doc;
-    doc["state"] = "ON";
-    doc["color_temp"] = round(1000000.0 / colorTemp);
-    sendLightCommand(doc);
-    
-    Serial.print("Light color temp: ");
-    Serial.println(colorTemp);
+    portENTER_CRITICAL(&pendingLock);
+    pending.colorTemp = constrain(colorTemp, MIN_COLOR_TEMP, MAX_COLOR_TEMP);
+    pending.lightOn = true;
+    pending.flags |= PENDING_COLOR_TEMP;
+    portEXIT_CRITICAL(&pendingLock);
 }
 
 void MQTTHandler::setHVACTemperature(float temperature) {
-    temperature = constrain(temperature, MIN_TEMPERATURE, MAX_TEMPERATURE);
-    
-    StaticJsonDocument<100> doc;
-    doc["temperature"] = temperature;
-    sendHVACCommand(doc);
-    
-    Serial.print("HVAC temperature: ");
-    Serial.println(temperature);
+    portENTER_CRITICAL(&pendingLock);
+    pending.temperature = constrain(temperature, MIN_TEMPERATURE, MAX_TEMPERATURE);
+    pending.flags |= PENDING_TEMPERATURE;
+    portEXIT_CRITICAL(&pendingLock);
 }
 
 void MQTTHandler::setHVACMode(const char* mode) {
-    StaticJsonDocument<100> doc;
-    doc["hvac_mode"] = mode;
-    sendHVACCommand(doc);
-    
-    Serial.print("HVAC mode: ");
-    Serial.println(mode);
+    portENTER_CRITICAL(&pendingLock);
+    strlcpy(pending.hvacMode, mode, sizeof(pending.hvacMode));
+    pending.flags |= PENDING_HVAC_MODE;
+    portEXIT_CRITICAL(&pendingLock);
 }
 
 void MQTTHandler::setHVACState(bool state) {
@@ -110,14 +155,60 @@ void MQTTHandler::setHVACState(bool state) {
     } else {
         setHVACMode("off");
     }
+}
+
+void MQTTHandler::sendPendingCommands() {
+    const unsigned long now = millis();
+    if (now - lastCommandMs < MQTT_COMMAND_INTERVAL) {
+        return;
+    }
     
-    Serial.print("HVAC state: ");
-    Serial.println(state ? "ON" : "OFF");
+    portENTER_CRITICAL(&pendingLock);
+    const PendingCommands cmd = pending;
+    pending.flags = 0;
+    portEXIT_CRITICAL(&pendingLock);
+    
+    if (!cmd.flags) {
+        return;
+    }
+    lastCommandMs = now;
+    
+    // One command per entity carries everything the UI changed since the
+    // last one; brightness and color temperature imply turning the light on
+    if (cmd.flags & (PENDING_LIGHT_STATE | PENDING_BRIGHTNESS | PENDING_COLOR_TEMP)) {
+        StaticJsonDocument<150> doc;
+        doc["state"] = cmd.lightOn ? "ON" : "OFF";
+        if (cmd.flags & PENDING_BRIGHTNESS) {
+            doc["brightness"] = map(cmd.brightness, 0, 100, 0, 255);
+        }
+        if (cmd.flags & PENDING_COLOR_TEMP) {
+            doc["color_temp"] = round(1000000.0 / cmd.colorTemp);
+        }
+        sendLightCommand(doc);
+    }
+    
+    if (cmd.flags & (PENDING_HVAC_MODE | PENDING_TEMPERATURE)) {
+        StaticJsonDocument<100> doc;
+        if (cmd.flags & PENDING_HVAC_MODE) {
+            doc["hvac_mode"] = cmd.hvacMode;
+        }
+        if (cmd.flags & PENDING_TEMPERATURE) {
+            doc["temperature"] = cmd.temperature;
+        }
+        sendHVACCommand(doc);
+        
+        if (cmd.flags & PENDING_HVAC_MODE) {
+            LOG_I(TAG, "HVAC mode: %s", cmd.hvacMode);
+        }
+        if (cmd.flags & PENDING_TEMPERATURE) {
+            LOG_I(TAG, "HVAC temperature: %.1f", cmd.temperature);
+        }
+    }
 }
 
 void MQTTHandler::sendLightCommand(JsonDocument& doc) {
     if (!mqttClient->connected()) {
-        Serial.println("MQTT not connected");
+        LOG_W(TAG, "MQTT not connected");
         return;
     }
     
@@ -125,16 +216,15 @@ void MQTTHandler::sendLightCommand(JsonDocument& doc) {
     serializeJson(doc, payload);
     
     if (mqttClient->publish(LIGHT_COMMAND_TOPIC, payload.c_str())) {
-        Serial.print("Light command: ");
-        Serial.println(payload);
+        LOG_D(TAG, "Light command: %s", payload.c_str());
     } else {
-        Serial.println("Failed to publish light command");
+        LOG_E(TAG, "Failed to publish light command");
     }
 }
 
 void MQTTHandler::sendHVACCommand(JsonDocument& doc) {
     if (!mqttClient->connected()) {
-        Serial.println("MQTT not connected");
+        LOG_W(TAG, "MQTT not connected");
         return;
     }
     
@@ -142,99 +232,141 @@ void MQTTHandler::sendHVACCommand(JsonDocument& doc) {
     serializeJson(doc, payload);
     
     if (mqttClient->publish(HVAC_COMMAND_TOPIC, payload.c_str())) {
-        Serial.print("HVAC command: ");
-        Serial.println(payload);
+        LOG_D(TAG, "HVAC command: %s", payload.c_str());
     } else {
-        Serial.println("Failed to publish HVAC command");
+        LOG_E(TAG, "Failed to publish HVAC command");
     }
 }
 
 void MQTTHandler::messageCallback(char* topic, byte* payload, unsigned int length) {
-    if (instance) {
-        char message[length + 1];
-        memcpy(message, payload, length);
-        message[length] = '\0';
-        
-        instance->processMessage(topic, message);
+    if (!instance) {
+        return;
+    }
+    
+    MqttRxStats& stats = instance->rxStats;
+    stats.messages++;
+    if (length > stats.largestPayload) {
+        stats.largestPayload = length;
+    }
+    if (length > MQTT_MAX_PAYLOAD_BYTES) {
+        stats.oversized++;
+        LOG_W(TAG, "MQTT payload of %u bytes on %s dropped", length, topic);
+        return;
+    }
+    
+    instance->processMessage(topic, (const char*)payload, length);
+    
+    const uint32_t stackFree = uxTaskGetStackHighWaterMark(NULL) * sizeof(StackType_t);
+    if (!stats.stackFreeMin || stackFree < stats.stackFreeMin) {
+        stats.stackFreeMin = stackFree;
     }
 }
 
-void MQTTHandler::processMessage(const char* topic, const char* payload) {
-    Serial.print("MQTT received - Topic: ");
-    Serial.print(topic);
-    Serial.print(", Payload: ");
-    Serial.println(payload);
+void MQTTHandler::processMessage(const char* topic, const char* payload, size_t length) {
+    LOG_D(TAG, "MQTT received - Topic: %s, Payload: %.*s", topic, (int)length, payload);
     
-    if (strcmp(topic, LIGHT_STATE_TOPIC) == 0) {
-        processLightUpdate(payload);
-    } else if (strcmp(topic, HVAC_STATE_TOPIC) == 0) {
-        processHVACUpdate(payload);
-    } else if (strcmp(topic, "homeassistant/status") == 0) {
-        if (strcmp(payload, "online") == 0) {
-            Serial.println("HA online, requesting status");
-            requestStatusUpdate();
-        }
+    if (!router.dispatch(topic, payload, length)) {
+        rxStats.unrouted++;
+        LOG_W(TAG, "No route for topic %s", topic);
     }
 }
 
-void MQTTHandler::processLightUpdate(const char* payload) {
-    StaticJsonDocument<500> doc;
-    DeserializationError error = deserializeJson(doc, payload);
-    
-    if (error) {
-        Serial.print("Light JSON parse error: ");
-        Serial.println(error.c_str());
+void MQTTHandler::onLightState(uint8_t slot, const char* topic, const char* payload, size_t length) {
+    instance->processLightUpdate(payload, length);
+}
+
+void MQTTHandler::onHVACState(uint8_t slot, const char* topic, const char* payload, size_t length) {
+    instance->processHVACUpdate(payload, length);
+}
+
+void MQTTHandler::onDiagnosticsCommand(uint8_t slot, const char* topic, const char* payload, size_t length) {
+    perfMonitorSetOverlay(payloadEquals(payload, length, "ON"));
+}
+
+void MQTTHandler::onHomeAssistantStatus(uint8_t slot, const char* topic, const char* payload, size_t length) {
+    if (payloadEquals(payload, length, "online")) {
+        LOG_I(TAG, "HA online, requesting status");
+        instance->requestStatusUpdate();
+    }
+}
+
+void MQTTHandler::processLightUpdate(const char* payload, size_t length) {
+    LightStateFields fields;
+    if (!parseLightState(payload, length, &fields)) {
+        rxStats.parseErrors++;
+        LOG_W(TAG, "Light JSON parse error");
         return;
     }
     
-    if (doc.containsKey("state")) {
-        lightState.isOn = (doc["state"] == "ON");
+    if (fields.hasState) {
+        lightState.isOn = fields.on;
         lightState.available = true;
     }
     
-    if (doc.containsKey("brightness")) {
-        lightState.brightness = map(doc["brightness"].as<int>(), 0, 255, 0, 100);
+    if (fields.hasBrightness) {
+        lightState.brightness = map(fields.brightness, 0, 255, 0, 100);
     }
     
-    if (doc.containsKey("color_temp")) {
-        int mireds = doc["color_temp"];
-        lightState.colorTemp = constrain(round(1000000.0 / mireds), MIN_COLOR_TEMP, MAX_COLOR_TEMP);
+    if (fields.hasColorTemp) {
+        lightState.colorTemp = constrain(round(1000000.0 / fields.colorTempMireds), MIN_COLOR_TEMP, MAX_COLOR_TEMP);
     }
     
-    if (screenManager) {
-        screenManager->updateLightStatus();
-    }
+    queueLightUpdate();
     
-    Serial.println("Light state updated");
+    LOG_D(TAG, "Light state updated");
 }
 
-void MQTTHandler::processHVACUpdate(const char* payload) {
-    StaticJsonDocument<500> doc;
-    DeserializationError error = deserializeJson(doc, payload);
-    
-    if (error) {
-        Serial.print("HVAC JSON parse error: ");
-        Serial.println(error.c_str());
+void MQTTHandler::processHVACUpdate(const char* payload, size_t length) {
+    HvacStateFields fields;
+    if (!parseHvacState(payload, length, &fields)) {
+        rxStats.parseErrors++;
+        LOG_W(TAG, "HVAC JSON parse error");
         return;
     }
     
-    if (doc.containsKey("hvac_mode")) {
-        hvacState.mode = doc["hvac_mode"].as<String>();
+    if (fields.hasMode) {
+        hvacState.mode = fields.mode;
         hvacState.isOn = (hvacState.mode != "off");
         hvacState.available = true;
     }
     
-    if (doc.containsKey("current_temperature")) {
-        hvacState.currentTemp = doc["current_temperature"];
+    if (fields.hasCurrentTemp) {
+        hvacState.currentTemp = fields.currentTemp;
     }
     
-    if (doc.containsKey("temperature")) {
-        hvacState.targetTemp = doc["temperature"];
+    if (fields.hasTargetTemp) {
+        hvacState.targetTemp = fields.targetTemp;
     }
     
-    if (screenManager) {
-        screenManager->updateHVACStatus();
-    }
+    queueHVACUpdate();
     
-    Serial.println("HVAC state updated");
+    LOG_D(TAG, "HVAC state updated");
+}
+
+// The widgets belong to the LVGL task, hand it a copy of the state
+void MQTTHandler::queueLightUpdate() {
+    UiUpdate msg;
+    msg.type = UI_UPDATE_LIGHT;
+    msg.light.isOn = lightState.isOn;
+    msg.light.available = lightState.available;
+    msg.light.brightness = lightState.brightness;
+    msg.light.colorTemp = lightState.colorTemp;
+    
+    if (!uiQueue.push(msg)) {
+        LOG_W(TAG, "UI queue full, light update dropped");
+    }
+}
+
+void MQTTHandler::queueHVACUpdate() {
+    UiUpdate msg;
+    msg.type = UI_UPDATE_HVAC;
+    msg.hvac.isOn = hvacState.isOn;
+    msg.hvac.available = hvacState.available;
+    msg.hvac.currentTemp = hvacState.currentTemp;
+    msg.hvac.targetTemp = hvacState.targetTemp;
+    strlcpy(msg.hvac.mode, hvacState.mode.c_str(), sizeof(msg.hvac.mode));
+    
+    if (!uiQueue.push(msg)) {
+        LOG_W(TAG, "UI queue full, HVAC update dropped");
+    }
 }
\ No newline at end of file
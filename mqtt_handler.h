@@ -4,15 +4,43 @@
 #include <PubSubClient.h>
 #include <ArduinoJson.h>
 #include "config.h"
+#include "topic_router.h"
 
 class ScreenManager;
 
+// Receive path counters, only updated and read on the loop task
+struct MqttRxStats {
+    uint32_t messages = 0;
+    uint32_t oversized = 0;         // dropped, longer than MQTT_MAX_PAYLOAD_BYTES
+    uint32_t unrouted = 0;
+    uint32_t parseErrors = 0;
+    uint32_t largestPayload = 0;
+    uint32_t stackFreeMin = 0;      // loop task stack high-water mark after handling a message, bytes
+    uint32_t bufferSize = 0;        // PubSubClient packet buffer, larger packets never arrive
+    bool bufferInPsram = false;
+};
+
+// Commands the UI asked for and the loop task has not sent yet, newest
+// value of each
+struct PendingCommands {
+    uint8_t flags = 0;
+    bool lightOn = false;
+    int brightness = 0;
+    int colorTemp = 0;
+    float temperature = 0;
+    char hvacMode[12] = "";     // fits every Home Assistant hvac_mode
+};
+
 class MQTTHandler {
 public:
     void init(PubSubClient* client, ScreenManager* screenMgr);
     void subscribeToTopics();
     void requestStatusUpdate();
     
+    // Safe from the LVGL task: they only record the command, and
+    // sendPendingCommands() publishes it from the loop task, next to
+    // mqttClient.loop(). A newer value of the same command replaces one
+    // that has not gone out yet.
     void setLightState(bool state);
     void setLightBrightness(int brightness);
     void setLightColorTemp(int colorTemp);
@@ -21,15 +49,37 @@ public:
     void setHVACMode(const char* mode);
     void setHVACState(bool state);
     
+    // Loop task only, while connected. Sends what the UI asked for, at
+    // most once per MQTT_COMMAND_INTERVAL.
+    void sendPendingCommands();
+    
+    // PubSubClient callback. The payload is not NUL-terminated and is only
+    // valid during the call; every handler works on (payload, length).
     static void messageCallback(char* topic, byte* payload, unsigned int length);
     
+    MqttRxStats getRxStats() const { return rxStats; }
+    
 private:
     PubSubClient* mqttClient;
     ScreenManager* screenManager;
+    TopicRouter router;
+    MqttRxStats rxStats;
+    PendingCommands pending;            // guarded by a spinlock in mqtt_handler.cpp
+    unsigned long lastCommandMs = 0;
+    
+    // Every topic the panel follows, with the handler and entity slot it goes to
+    static const TopicRoute routes[];
+    static void onLightState(uint8_t slot, const char* topic, const char* payload, size_t length);
+    static void onHVACState(uint8_t slot, const char* topic, const char* payload, size_t length);
+    static void onDiagnosticsCommand(uint8_t slot, const char* topic, const char* payload, size_t length);
+    static void onHomeAssistantStatus(uint8_t slot, const char* topic, const char* payload, size_t length);
     
-    void processMessage(const char* topic, const char* payload);
-    void processLightUpdate(const char* payload);
-    void processHVACUpdate(const char* payload);
+    void setupReceiveBuffer();
+    void processMessage(const char* topic, const char* payload, size_t length);
+    void processLightUpdate(const char* payload, size_t length);
+    void processHVACUpdate(const char* payload, size_t length);
+    void queueLightUpdate();
+    void queueHVACUpdate();
     
     void sendLightCommand(JsonDocument& doc);
     void sendHVACCommand(JsonDocument& doc);
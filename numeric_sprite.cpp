@@ -0,0 +1,91 @@
+#include "numeric_sprite.h"
+#include <Arduino.h>
+#include "esp_heap_caps.h"
+#include "log_ring.h"
+
+static const char *TAG = "numeric_sprite";
+
+bool NumericSprite::init(lv_obj_t* parent, const lv_font_t* font, lv_color_t color, lv_color_t bgColor,
+                         int minValue, int maxValue) {
+    const int count = maxValue - minValue + 1;
+    if (count <= 0 || img) {
+        return false;
+    }
+    
+    // One cell size for all values: the widest text, a full line high
+    char text[12];
+    lv_coord_t w = 0;
+    for (int v = minValue; v <= maxValue; v++) {
+        lv_point_t size;
+        snprintf(text, sizeof(text), "%d", v);
+        lv_txt_get_size(&size, text, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+        w = LV_MAX(w, size.x);
+    }
+    const lv_coord_t h = lv_font_get_line_height(font);
+    const size_t spriteBytes = (size_t)w * h * sizeof(lv_color_t);
+    
+    atlas = (uint8_t*)heap_caps_malloc(spriteBytes * count, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    sprites = (lv_img_dsc_t*)calloc(count, sizeof(lv_img_dsc_t));
+    if (!atlas || !sprites) {
+        LOG_E(TAG, "Failed to allocate numeric sprite atlas!");
+        heap_caps_free(atlas);
+        free(sprites);
+        atlas = nullptr;
+        sprites = nullptr;
+        return false;
+    }
+    
+    // Draw each value once through a throwaway canvas
+    lv_obj_t* canvas = lv_canvas_create(parent);
+    lv_draw_label_dsc_t labelDsc;
+    lv_draw_label_dsc_init(&labelDsc);
+    labelDsc.font = font;
+    labelDsc.color = color;
+    labelDsc.align = LV_TEXT_ALIGN_CENTER;
+    
+    for (int i = 0; i < count; i++) {
+        uint8_t* buf = atlas + i * spriteBytes;
+        lv_canvas_set_buffer(canvas, buf, w, h, LV_IMG_CF_TRUE_COLOR);
+        lv_canvas_fill_bg(canvas, bgColor, LV_OPA_COVER);
+        snprintf(text, sizeof(text), "%d", minValue + i);
+        lv_canvas_draw_text(canvas, 0, 0, w, &labelDsc, text);
+        
+        sprites[i].header.cf = LV_IMG_CF_TRUE_COLOR;
+        sprites[i].header.always_zero = 0;
+        sprites[i].header.w = w;
+        sprites[i].header.h = h;
+        sprites[i].data_size = spriteBytes;
+        sprites[i].data = buf;
+    }
+    lv_obj_del(canvas);
+    
+    this->minValue = minValue;
+    this->maxValue = maxValue;
+    width = w;
+    height = h;
+    
+    img = lv_img_create(parent);
+    lv_obj_set_size(img, w, h);
+    setValue(minValue);
+    
+    LOG_I(TAG, "%d sprites of %dx%d, %u bytes in PSRAM", count, w, h, (unsigned)(spriteBytes * count));
+    return true;
+}
+
+bool NumericSprite::setValue(int newValue) {
+    if (!img) {
+        return false;
+    }
+    if (newValue < minValue || newValue > maxValue) {
+        lv_obj_add_flag(img, LV_OBJ_FLAG_HIDDEN);
+        return false;
+    }
+    
+    lv_obj_clear_flag(img, LV_OBJ_FLAG_HIDDEN);
+    if (newValue != value || lv_img_get_src(img) == NULL) {
+        // Same size as before, so LVGL only invalidates this rectangle
+        lv_img_set_src(img, &sprites[newValue - minValue]);
+        value = newValue;
+    }
+    return true;
+}
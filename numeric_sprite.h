@@ -0,0 +1,39 @@
+#ifndef NUMERIC_SPRITE_H
+#define NUMERIC_SPRITE_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// Integer display for a small, fixed range of values. Every value is drawn
+// once at init into an opaque RGB565 sprite in PSRAM; showing a value only
+// swaps the image source, so LVGL invalidates the sprite's rectangle and
+// blits it instead of laying out and rasterizing a label. All sprites
+// share one size, centered text, so a change never leaves a stale edge.
+class NumericSprite {
+public:
+    // Renders minValue..maxValue. Returns false if the atlas could not be
+    // allocated; the caller should keep using a label then.
+    bool init(lv_obj_t* parent, const lv_font_t* font, lv_color_t color, lv_color_t bgColor,
+              int minValue, int maxValue);
+    
+    // Returns false, and hides the sprite, for a value outside the range
+    bool setValue(int value);
+    int getValue() const { return value; }
+    bool isReady() const { return img != nullptr; }
+    
+    lv_obj_t* getObj() const { return img; }
+    lv_coord_t getWidth() const { return width; }
+    lv_coord_t getHeight() const { return height; }
+    
+private:
+    lv_obj_t* img = nullptr;
+    lv_img_dsc_t* sprites = nullptr;
+    uint8_t* atlas = nullptr;
+    int minValue = 0;
+    int maxValue = -1;
+    int value = 0;
+    lv_coord_t width = 0;
+    lv_coord_t height = 0;
+};
+
+#endif // NUMERIC_SPRITE_H
@@ -0,0 +1,16 @@
+#include "pclk_search.h"
+
+uint32_t pclk_search(const uint32_t *rates, size_t count, int rounds, pclk_probe_fn probe, void *ctx)
+{
+    uint32_t best = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        for (int r = 0; r < rounds; r++) {
+            if (!probe(rates[i], ctx)) {
+                return best;
+            }
+        }
+        best = rates[i];
+    }
+    return best;
+}
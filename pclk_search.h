@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Check whether the panel link works at a clock rate
+ *
+ * @param[in] hz Clock rate to try
+ * @param[in] ctx User context passed to `pclk_search`
+ * @return true if every transfer at this rate was verified
+ */
+typedef bool (*pclk_probe_fn)(uint32_t hz, void *ctx);
+
+/**
+ * @brief Find the fastest clock rate the panel link handles reliably
+ *
+ * @note  Rates are tried in the given (ascending) order, each `rounds` times. The search stops at the first
+ *        rate that fails once; faster rates are not tried, so a marginal rate never passes by luck.
+ * @note  Free of any ESP-IDF dependency so it can be exercised against a simulated panel IO.
+ *
+ * @param[in] rates Candidate rates, ascending
+ * @param[in] count Number of candidates
+ * @param[in] rounds Probes per rate
+ * @param[in] probe Probe callback
+ * @param[in] ctx User context for `probe`
+ * @return The highest rate that passed every round, or 0 if the first rate already failed
+ */
+uint32_t pclk_search(const uint32_t *rates, size_t count, int rounds, pclk_probe_fn probe, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,143 @@
+#include "perf_monitor.h"
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "log_ring.h"
+#include "display_pipeline.h"
+#include "lvgl_mem.h"
+#include "refresh_governor.h"
+#include "ui_styles.h"
+
+static const char *TAG = "perf_monitor";
+
+// A touch that never leads to a refresh (holding a finger still) is
+// dropped after this long instead of being counted at the next one
+#define TOUCH_LATENCY_MAX_US (REFRESH_ACTIVE_HOLD_MS * 1000)
+
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+static PerfMonitorStats stats;
+static volatile bool overlayWanted = PERF_OVERLAY;
+static lv_obj_t *overlay = NULL;
+
+// Counters of the current window, only touched on the LVGL task
+static int64_t windowStartUs = 0;
+static uint32_t windowFrames = 0;
+static uint32_t windowFrameMs = 0;
+static uint32_t windowFrameMaxMs = 0;
+static uint64_t windowPx = 0;
+static uint32_t windowTouches = 0;
+static uint32_t windowTouchUs = 0;
+static uint32_t windowTouchMaxUs = 0;
+static int64_t pendingTouchUs = 0;      // first sample not shown by a refresh yet
+
+void perfMonitorFrame(uint32_t timeMs, uint32_t px) {
+    windowFrames++;
+    windowFrameMs += timeMs;
+    windowFrameMaxMs = LV_MAX(windowFrameMaxMs, timeMs);
+    windowPx += px;
+
+    if (pendingTouchUs) {
+        const uint32_t latencyUs = (uint32_t)(esp_timer_get_time() - pendingTouchUs);
+        pendingTouchUs = 0;
+        if (latencyUs <= TOUCH_LATENCY_MAX_US) {
+            windowTouches++;
+            windowTouchUs += latencyUs;
+            windowTouchMaxUs = LV_MAX(windowTouchMaxUs, latencyUs);
+        }
+    }
+}
+
+void perfMonitorTouchSample(int64_t sampleUs, bool pressed) {
+    if (!pressed || sampleUs <= 0) {
+        return;
+    }
+    if (pendingTouchUs && esp_timer_get_time() - pendingTouchUs > TOUCH_LATENCY_MAX_US) {
+        pendingTouchUs = 0;
+    }
+    if (!pendingTouchUs) {
+        pendingTouchUs = sampleUs;
+    }
+}
+
+void perfMonitorSetOverlay(bool show) {
+    overlayWanted = show;
+}
+
+static void updateOverlay(const PerfMonitorStats &s) {
+    if (!overlayWanted) {
+        if (overlay) {
+            lv_obj_add_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+        }
+        return;
+    }
+
+    // On the system layer, above every screen and the overview
+    if (!overlay) {
+        uiStylesInit();
+        overlay = lv_label_create(lv_layer_sys());
+        lv_obj_add_style(overlay, &uiStyles.overlay, 0);
+        lv_obj_align(overlay, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+    }
+    lv_obj_clear_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+    lv_label_set_text_fmt(overlay, "%u fps %u/%u ms %uk px %u%% cpu\nr %u f %u us lvgl %u%% touch %u ms",
+                          (unsigned)s.fps, (unsigned)s.frameMs, (unsigned)s.frameMaxMs,
+                          (unsigned)(s.pxPerFrame / 1000), (unsigned)s.cpuPct, (unsigned)s.renderUs,
+                          (unsigned)s.flushUs, (unsigned)s.lvglUsedPct, (unsigned)s.touchLatencyMs);
+}
+
+static void sampleTimerCb(lv_timer_t *timer) {
+    const int64_t now = esp_timer_get_time();
+    const float seconds = (now - windowStartUs) / 1e6f;
+    if (seconds <= 0) {
+        return;
+    }
+
+    PerfMonitorStats s;
+    s.fps = (uint32_t)(windowFrames / seconds + 0.5f);
+    s.frameMs = windowFrames ? windowFrameMs / windowFrames : 0;
+    s.frameMaxMs = windowFrameMaxMs;
+    s.pxPerFrame = windowFrames ? (uint32_t)(windowPx / windowFrames) : 0;
+    s.pxPerSec = (uint32_t)(windowPx / seconds);
+    s.touchLatencyMs = windowTouches ? windowTouchUs / windowTouches / 1000 : 0;
+    s.touchLatencyMaxMs = windowTouchMaxUs / 1000;
+
+    const DisplayPipelineStats pipeline = getDisplayPipelineStats();
+    s.renderUs = pipeline.renderUs;
+    s.flushUs = pipeline.flushUs;
+
+    const RefreshGovernorStats governor = getRefreshGovernorStats();
+    s.cpuPct = governor.cpuUsPerSec / 10000;
+
+    const LvglMemStats mem = getLvglMemStats();
+    s.lvglFreeBytes = mem.freeBytes;
+    s.lvglUsedPct = mem.usedPct;
+    s.lvglFragPct = mem.fragPct;
+
+    windowStartUs = now;
+    windowFrames = 0;
+    windowFrameMs = 0;
+    windowFrameMaxMs = 0;
+    windowPx = 0;
+    windowTouches = 0;
+    windowTouchUs = 0;
+    windowTouchMaxUs = 0;
+
+    portENTER_CRITICAL(&statsLock);
+    stats = s;
+    portEXIT_CRITICAL(&statsLock);
+
+    updateOverlay(s);
+}
+
+void perfMonitorInit() {
+    windowStartUs = esp_timer_get_time();
+    lv_timer_create(sampleTimerCb, PERF_MONITOR_PERIOD_MS, NULL);
+    LOG_I(TAG, "Perf monitor every %d ms, overlay %s", PERF_MONITOR_PERIOD_MS, overlayWanted ? "on" : "off");
+}
+
+PerfMonitorStats getPerfMonitorStats() {
+    portENTER_CRITICAL(&statsLock);
+    PerfMonitorStats copy = stats;
+    portEXIT_CRITICAL(&statsLock);
+    return copy;
+}
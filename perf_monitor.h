@@ -0,0 +1,42 @@
+#ifndef PERF_MONITOR_H
+#define PERF_MONITOR_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// Render health over the last PERF_MONITOR_PERIOD_MS window. Frames come
+// from LVGL's monitor_cb, render and flush time from the display
+// pipeline, the heap from lvgl_mem. Touch latency runs from the moment
+// the controller was read to the end of the next refresh.
+struct PerfMonitorStats {
+    uint32_t fps = 0;
+    uint32_t frameMs = 0;           // one LVGL refresh, average
+    uint32_t frameMaxMs = 0;
+    uint32_t renderUs = 0;          // per refresh cycle, 0 without the pipeline
+    uint32_t flushUs = 0;
+    uint32_t pxPerFrame = 0;        // invalidated pixels redrawn, average
+    uint32_t pxPerSec = 0;
+    uint32_t cpuPct = 0;            // LVGL task busy in lv_timer_handler()
+    uint32_t lvglFreeBytes = 0;
+    uint8_t lvglUsedPct = 0;
+    uint8_t lvglFragPct = 0;
+    uint32_t touchLatencyMs = 0;    // average, 0 if nothing was touched
+    uint32_t touchLatencyMaxMs = 0;
+};
+
+// Starts sampling. Call after lv_init() and lvglMemInit(); shows the
+// overlay right away when PERF_OVERLAY is set.
+void perfMonitorInit();
+
+// LVGL display driver monitor_cb, counts frames and their pixels
+void perfMonitorFrame(uint32_t timeMs, uint32_t px);
+
+// From the indev read callback, with the time the sample was read
+void perfMonitorTouchSample(int64_t sampleUs, bool pressed);
+
+// Shows or hides the overlay at the next sample. Safe from any task.
+void perfMonitorSetOverlay(bool show);
+
+PerfMonitorStats getPerfMonitorStats();
+
+#endif
@@ -0,0 +1,217 @@
+#include <string.h>
+
+#include "config.h"
+#include "pixel_convert.h"
+
+#define IS_WORD_ALIGNED(p)  ((((uintptr_t)(p)) & 3) == 0)
+
+static inline void rgb565_split(uint16_t p, uint8_t *r5, uint8_t *g6, uint8_t *b5)
+{
+    *r5 = (p >> 11) & 0x1F;
+    *g6 = (p >> 5) & 0x3F;
+    *b5 = p & 0x1F;
+}
+
+void pixel_rgb565_swap_ref(uint16_t *dst, const uint16_t *src, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        uint16_t p = src[i];
+        dst[i] = (uint16_t)((p << 8) | (p >> 8));
+    }
+}
+
+void pixel_rgb565_to_rgb666_ref(uint8_t *dst, const uint16_t *src, size_t count)
+{
+    uint8_t r, g, b;
+
+    // backwards, so the conversion also works in place
+    for (size_t i = count; i-- > 0;) {
+        rgb565_split(src[i], &r, &g, &b);
+        dst[i * 3 + 0] = (uint8_t)(((r << 1) | (r >> 4)) << 2);
+        dst[i * 3 + 1] = (uint8_t)(g << 2);
+        dst[i * 3 + 2] = (uint8_t)(((b << 1) | (b >> 4)) << 2);
+    }
+}
+
+void pixel_rgb565_to_rgb888_ref(uint8_t *dst, const uint16_t *src, size_t count)
+{
+    uint8_t r, g, b;
+
+    for (size_t i = count; i-- > 0;) {
+        rgb565_split(src[i], &r, &g, &b);
+        dst[i * 3 + 0] = (uint8_t)((r << 3) | (r >> 2));
+        dst[i * 3 + 1] = (uint8_t)((g << 2) | (g >> 4));
+        dst[i * 3 + 2] = (uint8_t)((b << 3) | (b >> 2));
+    }
+}
+
+void pixel_rgb565_swap(uint16_t *dst, const uint16_t *src, size_t count)
+{
+    if (!IS_WORD_ALIGNED(dst) || !IS_WORD_ALIGNED(src)) {
+        pixel_rgb565_swap_ref(dst, src, count);
+        return;
+    }
+
+    // two pixels per word, four words per iteration
+    const uint32_t *s = (const uint32_t *)src;
+    uint32_t *d = (uint32_t *)dst;
+    size_t words = count / 2;
+    size_t i = 0;
+    for (; i + 4 <= words; i += 4) {
+        uint32_t v0 = s[i], v1 = s[i + 1], v2 = s[i + 2], v3 = s[i + 3];
+        d[i] = ((v0 & 0x00FF00FF) << 8) | ((v0 >> 8) & 0x00FF00FF);
+        d[i + 1] = ((v1 & 0x00FF00FF) << 8) | ((v1 >> 8) & 0x00FF00FF);
+        d[i + 2] = ((v2 & 0x00FF00FF) << 8) | ((v2 >> 8) & 0x00FF00FF);
+        d[i + 3] = ((v3 & 0x00FF00FF) << 8) | ((v3 >> 8) & 0x00FF00FF);
+    }
+    for (; i < words; i++) {
+        uint32_t v = s[i];
+        d[i] = ((v & 0x00FF00FF) << 8) | ((v >> 8) & 0x00FF00FF);
+    }
+    if (count & 1) {
+        pixel_rgb565_swap_ref(dst + count - 1, src + count - 1, 1);
+    }
+}
+
+// Expands four pixels held in two words into three output words. Each
+// channel is computed for both pixels of a word at once, the 16-bit
+// lanes never carry into each other.
+#define EXPAND_LANES(v, r, g, b, R_EXPAND, G_EXPAND, B_EXPAND)    \
+    do {                                                        \
+        uint32_t r5 = ((v) >> 11) & 0x001F001F;                 \
+        uint32_t g6 = ((v) >> 5) & 0x003F003F;                  \
+        uint32_t b5 = (v) & 0x001F001F;                         \
+        r = R_EXPAND(r5);                                       \
+        g = G_EXPAND(g6);                                       \
+        b = B_EXPAND(b5);                                       \
+    } while (0)
+
+// The right shifts are masked so bits never leak from one lane to the other
+#define RGB888_R(c) (((c) << 3) | (((c) >> 2) & 0x00070007))
+#define RGB888_G(c) (((c) << 2) | (((c) >> 4) & 0x00030003))
+#define RGB666_R(c) ((((c) << 1) | (((c) >> 4) & 0x00010001)) << 2)
+#define RGB666_G(c) ((c) << 2)
+
+static inline void pack_rgb_words(uint32_t *d, uint32_t ra, uint32_t ga, uint32_t ba, uint32_t rb, uint32_t gb, uint32_t bb)
+{
+    // pixels 0,1 come from lane 0/1 of the "a" word, 2,3 from the "b" word
+    d[0] = (ra & 0xFF) | ((ga & 0xFF) << 8) | ((ba & 0xFF) << 16) | ((ra >> 16) << 24);
+    d[1] = (ga >> 16) | ((ba >> 16) << 8) | ((rb & 0xFF) << 16) | ((gb & 0xFF) << 24);
+    d[2] = (bb & 0xFF) | ((rb >> 16) << 8) | ((gb >> 16) << 16) | ((bb >> 16) << 24);
+}
+
+#define DEFINE_EXPAND_KERNEL(name, ref, R_EXPAND, G_EXPAND)                         \
+    void name(uint8_t *dst, const uint16_t *src, size_t count)                      \
+    {                                                                               \
+        if (!IS_WORD_ALIGNED(dst) || !IS_WORD_ALIGNED(src)) {                       \
+            ref(dst, src, count);                                                   \
+            return;                                                                 \
+        }                                                                           \
+        size_t blocks = count / 4;                                                  \
+        size_t tail = count - blocks * 4;                                           \
+        /* backwards: the tail first, then blocks of four from the end */           \
+        ref(dst + blocks * 12, src + blocks * 4, tail);                             \
+        for (size_t i = blocks; i-- > 0;) {                                         \
+            const uint32_t *s = (const uint32_t *)(src + i * 4);                    \
+            uint32_t va = s[0], vb = s[1];                                          \
+            uint32_t ra, ga, ba, rb, gb, bb;                                        \
+            EXPAND_LANES(va, ra, ga, ba, R_EXPAND, G_EXPAND, R_EXPAND);             \
+            EXPAND_LANES(vb, rb, gb, bb, R_EXPAND, G_EXPAND, R_EXPAND);             \
+            pack_rgb_words((uint32_t *)(dst + i * 12), ra, ga, ba, rb, gb, bb);     \
+        }                                                                           \
+    }
+
+DEFINE_EXPAND_KERNEL(pixel_rgb565_to_rgb888, pixel_rgb565_to_rgb888_ref, RGB888_R, RGB888_G)
+DEFINE_EXPAND_KERNEL(pixel_rgb565_to_rgb666, pixel_rgb565_to_rgb666_ref, RGB666_R, RGB666_G)
+
+// Square blocks of 16x16 pixels: 512 bytes read and written per block
+#define ROTATE_BLOCK 16
+
+void pixel_rgb565_rotate_ref(uint16_t *dst, const uint16_t *src, int w, int h, int degrees)
+{
+    if (degrees == 0) {
+        memcpy(dst, src, (size_t)w * h * sizeof(uint16_t));
+        return;
+    }
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            const uint16_t p = src[y * w + x];
+            if (degrees == 90) {
+                dst[(w - 1 - x) * h + y] = p;
+            } else if (degrees == 270) {
+                dst[x * h + (h - 1 - y)] = p;
+            } else {
+                dst[(h - 1 - y) * w + (w - 1 - x)] = p;
+            }
+        }
+    }
+}
+
+static inline uint32_t swap_lanes(uint32_t v)
+{
+    return (v >> 16) | (v << 16);
+}
+
+void pixel_rgb565_rotate(uint16_t *dst, const uint16_t *src, int w, int h, int degrees)
+{
+    if (degrees == 0 || (w & 1) || (h & 1) || !IS_WORD_ALIGNED(dst) || !IS_WORD_ALIGNED(src)) {
+        pixel_rgb565_rotate_ref(dst, src, w, h, degrees);
+        return;
+    }
+
+    const uint32_t *s = (const uint32_t *)src;
+    uint32_t *d = (uint32_t *)dst;
+
+    if (degrees == 180) {
+        // reversing the pixel order turns the image upside down
+        const size_t words = (size_t)w * h / 2;
+        for (size_t i = 0; i < words; i++) {
+            d[words - 1 - i] = swap_lanes(s[i]);
+        }
+        return;
+    }
+
+    const int sw = w / 2;   // words per input row
+    const int dw = h / 2;   // words per output row
+    for (int by = 0; by < h; by += ROTATE_BLOCK) {
+        const int ey = by + ROTATE_BLOCK < h ? by + ROTATE_BLOCK : h;
+        for (int bx = 0; bx < w; bx += ROTATE_BLOCK) {
+            const int ex = bx + ROTATE_BLOCK < w ? bx + ROTATE_BLOCK : w;
+            for (int y = by; y < ey; y += 2) {
+                const uint32_t *s0 = s + y * sw;
+                const uint32_t *s1 = s0 + sw;
+                for (int x = bx; x < ex; x += 2) {
+                    // a holds pixels x, x+1 of row y, b the same of row y+1
+                    const uint32_t a = s0[x / 2];
+                    const uint32_t b = s1[x / 2];
+                    const uint32_t col0 = (a & 0xFFFF) | (b << 16);         // column x, rows y, y+1
+                    const uint32_t col1 = (a >> 16) | (b & 0xFFFF0000);     // column x+1
+                    if (degrees == 90) {
+                        d[(w - 1 - x) * dw + y / 2] = col0;
+                        d[(w - 2 - x) * dw + y / 2] = col1;
+                    } else {
+                        // rows y, y+1 end up at columns h-1-y, h-2-y, so in reverse order
+                        d[x * dw + (h - 2 - y) / 2] = swap_lanes(col0);
+                        d[(x + 1) * dw + (h - 2 - y) / 2] = swap_lanes(col1);
+                    }
+                }
+            }
+        }
+    }
+}
+
+size_t pixel_to_wire(void *dst, const uint16_t *src, size_t count)
+{
+#if LCD_BIT_PER_PIXEL == 24
+    pixel_rgb565_to_rgb888((uint8_t *)dst, src, count);
+#elif LCD_BIT_PER_PIXEL == 18
+    pixel_rgb565_to_rgb666((uint8_t *)dst, src, count);
+#elif LCD_SWAP_RGB565
+    pixel_rgb565_swap((uint16_t *)dst, src, count);
+#else
+    if (dst != src) {
+        memcpy(dst, src, count * sizeof(uint16_t));
+    }
+#endif
+    return count * LCD_BYTES_PER_PIXEL;
+}
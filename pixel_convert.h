@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Pixel format conversion between LVGL's native RGB565 and the SH8601 wire formats
+ *
+ * @note  Source pixels are native (little-endian) RGB565, as produced with `LV_COLOR_16_SWAP 0`.
+ *        The RGB666 and RGB888 outputs are three bytes per pixel in R, G, B order, RGB666 keeps each
+ *        component in the 6 high bits of its byte as COLMOD 0x66 expects.
+ * @note  All conversions may run in place (`dst == src`) as long as the buffer is large enough for the
+ *        output. The expanding conversions walk the buffer from the end so no unread source is overwritten.
+ * @note  The `_ref` variants are plain per-pixel reference implementations. The others process several
+ *        pixels per 32-bit word when both buffers are word aligned and must produce identical output.
+ */
+void pixel_rgb565_swap_ref(uint16_t *dst, const uint16_t *src, size_t count);
+void pixel_rgb565_to_rgb666_ref(uint8_t *dst, const uint16_t *src, size_t count);
+void pixel_rgb565_to_rgb888_ref(uint8_t *dst, const uint16_t *src, size_t count);
+
+void pixel_rgb565_swap(uint16_t *dst, const uint16_t *src, size_t count);
+void pixel_rgb565_to_rgb666(uint8_t *dst, const uint16_t *src, size_t count);
+void pixel_rgb565_to_rgb888(uint8_t *dst, const uint16_t *src, size_t count);
+
+/**
+ * @brief Convert pixels to the wire format selected by `LCD_BIT_PER_PIXEL` and `LCD_SWAP_RGB565`
+ *
+ * @param[out] dst Output buffer, `count * LCD_BYTES_PER_PIXEL` bytes
+ * @param[in]  src Native RGB565 pixels
+ * @param[in]  count Number of pixels
+ * @return Number of bytes written to `dst`
+ */
+size_t pixel_to_wire(void *dst, const uint16_t *src, size_t count);
+
+/**
+ * @brief Rotate a block of RGB565 pixels, following LVGL's LV_DISP_ROT_* orientations
+ *
+ * @param[out] dst Output, `h` pixels wide and `w` high for 90 and 270 degrees; must not overlap `src`
+ * @param[in]  src Input, `w * h` pixels row by row
+ * @param[in]  w Input width
+ * @param[in]  h Input height
+ * @param[in]  degrees 0, 90, 180 or 270; 0 copies
+ *
+ * @note  Input pixel (x, y) goes to (y, w - 1 - x) for 90 degrees, (h - 1 - y, x) for 270 degrees and
+ *        (w - 1 - x, h - 1 - y) for 180 degrees.
+ * @note  The fast variant walks the input in square blocks so reads and writes stay within a few cache
+ *        lines, and turns 2x2 pixel groups with two 32-bit loads and stores. It needs even `w` and `h`
+ *        and word aligned buffers, otherwise it falls back to the reference implementation.
+ */
+void pixel_rgb565_rotate_ref(uint16_t *dst, const uint16_t *src, int w, int h, int degrees);
+void pixel_rgb565_rotate(uint16_t *dst, const uint16_t *src, int w, int h, int degrees);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,146 @@
+#include "refresh_governor.h"
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "log_ring.h"
+#include "te_sync.h"
+
+static const char *TAG = "refresh_gov";
+
+static lv_disp_t *governedDisp = NULL;
+static TaskHandle_t lvglTask = NULL;
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+static RefreshGovernorStats stats;
+static volatile bool woken = false;
+static uint32_t appliedPeriodMs = 0;
+static uint32_t lastActiveMs = 0;
+
+// Counters of the current one second window
+static int64_t windowStartUs = 0;
+static uint32_t windowFrames = 0;
+static uint32_t windowBusyUs = 0;
+static uint32_t windowLoops = 0;
+
+void refreshGovernorInit(lv_disp_t *disp) {
+    governedDisp = disp;
+    lvglTask = xTaskGetCurrentTaskHandle();
+    windowStartUs = esp_timer_get_time();
+    lastActiveMs = lv_tick_get();
+    LOG_I(TAG, "Refresh governor on, %d ms when idle", REFRESH_DATA_PERIOD_MS);
+}
+
+void refreshGovernorWake() {
+    woken = true;
+    if (lvglTask) {
+        xTaskNotifyGive(lvglTask);
+    }
+}
+
+void refreshGovernorSleep(uint32_t ms) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+}
+
+void refreshGovernorMonitorCb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px) {
+    windowFrames++;
+}
+
+static bool anyIndevPressed() {
+    lv_indev_t *indev = NULL;
+    while ((indev = lv_indev_get_next(indev)) != NULL) {
+        if (indev->proc.state == LV_INDEV_STATE_PRESSED) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void setIndevPeriod(uint32_t periodMs, bool readNow) {
+    lv_indev_t *indev = NULL;
+    while ((indev = lv_indev_get_next(indev)) != NULL) {
+        lv_timer_t *timer = indev->driver->read_timer;
+        if (!timer) {
+            continue;
+        }
+        lv_timer_set_period(timer, periodMs);
+        if (readNow) {
+            lv_timer_ready(timer);
+        }
+    }
+}
+
+static void applyMode(RefreshMode mode) {
+    uint32_t periodMs = REFRESH_DATA_PERIOD_MS;
+    if (mode == REFRESH_MODE_ACTIVE) {
+        periodMs = teSyncGetRefreshPeriodMs();
+        if (!periodMs) {
+            periodMs = LV_DISP_REFR_PERIOD;
+        }
+    }
+    if (periodMs == appliedPeriodMs) {
+        return;
+    }
+
+    lv_timer_t *refr_timer = _lv_disp_get_refr_timer(governedDisp);
+    if (refr_timer) {
+        lv_timer_set_period(refr_timer, periodMs);
+    }
+    setIndevPeriod(mode == REFRESH_MODE_ACTIVE ? LV_INDEV_DEF_READ_PERIOD : REFRESH_IDLE_INDEV_MS, false);
+    appliedPeriodMs = periodMs;
+    // Counted rather than logged, this switches at touch rate
+    portENTER_CRITICAL(&statsLock);
+    stats.modeSwitches++;
+    portEXIT_CRITICAL(&statsLock);
+}
+
+uint32_t refreshGovernorRunTimers() {
+    // A new press should not wait for the slow touch read
+    if (woken) {
+        woken = false;
+        lastActiveMs = lv_tick_get();
+        applyMode(REFRESH_MODE_ACTIVE);
+        setIndevPeriod(LV_INDEV_DEF_READ_PERIOD, true);
+        portENTER_CRITICAL(&statsLock);
+        stats.wakeups++;
+        portEXIT_CRITICAL(&statsLock);
+    }
+
+    const int64_t start = esp_timer_get_time();
+    const uint32_t delayMs = lv_timer_handler();
+    const int64_t now = esp_timer_get_time();
+    windowBusyUs += (uint32_t)(now - start);
+    windowLoops++;
+
+    if (anyIndevPressed() || lv_anim_count_running() > 0) {
+        lastActiveMs = lv_tick_get();
+    }
+    const RefreshMode mode = lv_tick_elaps(lastActiveMs) < REFRESH_ACTIVE_HOLD_MS ? REFRESH_MODE_ACTIVE
+                                                                                   : REFRESH_MODE_DATA;
+    applyMode(mode);
+
+    const lv_timer_t *refr_timer = _lv_disp_get_refr_timer(governedDisp);
+    portENTER_CRITICAL(&statsLock);
+    stats.mode = mode;
+    stats.periodMs = appliedPeriodMs;
+    stats.refreshPaused = refr_timer && refr_timer->paused;
+    if (now - windowStartUs >= 1000000) {
+        const float seconds = (now - windowStartUs) / 1e6f;
+        stats.fps = (uint32_t)(windowFrames / seconds + 0.5f);
+        stats.cpuUsPerSec = (uint32_t)(windowBusyUs / seconds);
+        stats.loopsPerSec = (uint32_t)(windowLoops / seconds + 0.5f);
+        windowStartUs = now;
+        windowFrames = 0;
+        windowBusyUs = 0;
+        windowLoops = 0;
+    }
+    portEXIT_CRITICAL(&statsLock);
+
+    return delayMs;
+}
+
+RefreshGovernorStats getRefreshGovernorStats() {
+    portENTER_CRITICAL(&statsLock);
+    RefreshGovernorStats copy = stats;
+    portEXIT_CRITICAL(&statsLock);
+    return copy;
+}
@@ -0,0 +1,47 @@
+#ifndef REFRESH_GOVERNOR_H
+#define REFRESH_GOVERNOR_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// Sets how often the LVGL task works. While the panel is touched or an
+// animation runs, LVGL refreshes at the panel rate (paced to TE when
+// available). Otherwise it refreshes at REFRESH_DATA_PERIOD_MS and reads
+// touch every REFRESH_IDLE_INDEV_MS; a new press wakes the task right away
+// and makes the next touch read immediate.
+
+enum RefreshMode : uint8_t {
+    REFRESH_MODE_ACTIVE,    // touch or animation
+    REFRESH_MODE_DATA,      // only network updates change the screen
+};
+
+struct RefreshGovernorStats {
+    RefreshMode mode = REFRESH_MODE_ACTIVE;
+    bool refreshPaused = false;     // nothing invalidated, LVGL stopped its refresh timer
+    uint32_t periodMs = 0;          // current refresh period
+    uint32_t fps = 0;               // frames rendered in the last second
+    uint32_t cpuUsPerSec = 0;       // time in lv_timer_handler() in the last second
+    uint32_t loopsPerSec = 0;       // LVGL task iterations in the last second
+    uint32_t wakeups = 0;           // early wakeups by touch since boot
+    uint32_t modeSwitches = 0;      // refresh period changes since boot
+};
+
+// Call from the LVGL task before its loop
+void refreshGovernorInit(lv_disp_t *disp);
+
+// Runs LVGL's timers and adjusts their periods. Call from the LVGL task
+// with the LVGL lock held; returns the time until the next timer.
+uint32_t refreshGovernorRunTimers();
+
+// Sleeps for up to ms, or until refreshGovernorWake()
+void refreshGovernorSleep(uint32_t ms);
+
+// Wakes the LVGL task early, e.g. on a new touch. Safe from any task.
+void refreshGovernorWake();
+
+// LVGL display driver monitor_cb, counts frames
+void refreshGovernorMonitorCb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
+
+RefreshGovernorStats getRefreshGovernorStats();
+
+#endif
@@ -1,5 +1,8 @@
 #include "screen_manager.h"
 #include "mqtt_handler.h"
+#include "display_init.h"
+#include "ui_styles.h"
+#include "log_ring.h"
 #include <Arduino.h>
 
 // Declare your custom font
@@ -7,14 +10,20 @@ extern const lv_font_t montserrat_96;
 
 extern MQTTHandler mqttHandler;
 
+static const char *TAG = "screen";
+
 ScreenManager* ScreenManager::instance = nullptr;
 
 void ScreenManager::init() {
     instance = this;
+    uiStylesInit();
+    
+    // What the widgets take from the LVGL heap, shared styles included
+    lv_mem_monitor_t before;
+    lv_mem_monitor(&before);
     
     screenContainer = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(screenContainer, lv_color_black(), 0);
-    lv_obj_set_style_bg_opa(screenContainer, LV_OPA_COVER, 0);
+    lv_obj_add_style(screenContainer, &uiStyles.screen, 0);
     
     createAllScreens();
     setupGestureHandling();
@@ -22,36 +31,45 @@ void ScreenManager::init() {
     lv_scr_load(screenContainer);
     showScreen(SCREEN_HVAC);
     
-    Serial.println("Screen manager initialized with gesture support");
+    lv_mem_monitor_t after;
+    lv_mem_monitor(&after);
+    LOG_I(TAG, "UI widgets use %d bytes of LVGL heap", (int)(before.free_size - after.free_size));
+    
+#if DISPLAY_IDLE_VIEW_TIMEOUT_MS > 0
+    lv_timer_create(idleViewTimerCb, 100, this);
+#endif
+    // At the governor's data rate, so everything queued lands in the same frame
+    lv_timer_create(uiQueueTimerCb, REFRESH_DATA_PERIOD_MS, this);
+    
+    LOG_I(TAG, "Screen manager initialized with gesture support");
 }
 
 void ScreenManager::createAllScreens() {
     for (int i = 0; i < SCREEN_COUNT; i++) {
         screens[i] = nullptr;
+        liveRegions[i] = nullptr;
     }
     
     createLightScreen();
     createHVACScreen();
+    createOverview();
     
     screensCreated = true;
     
-    Serial.println("All screens created with gesture handling");
+    LOG_I(TAG, "All screens created with gesture handling");
 }
 
 void ScreenManager::createLightScreen() {
     screens[SCREEN_LIGHT] = lv_obj_create(screenContainer);
-    lv_obj_set_size(screens[SCREEN_LIGHT], SCREEN_WIDTH, SCREEN_HEIGHT);
-    lv_obj_set_style_bg_color(screens[SCREEN_LIGHT], lv_color_black(), 0);
-    lv_obj_set_style_border_width(screens[SCREEN_LIGHT], 0, 0);
-    lv_obj_set_style_pad_all(screens[SCREEN_LIGHT], 0, 0);
+    lv_obj_set_size(screens[SCREEN_LIGHT], lv_disp_get_hor_res(NULL), lv_disp_get_ver_res(NULL));
+    lv_obj_add_style(screens[SCREEN_LIGHT], &uiStyles.screen, 0);
     lv_obj_clear_flag(screens[SCREEN_LIGHT], LV_OBJ_FLAG_SCROLLABLE);
     
     // Large "B" label for brightness
     lv_obj_t* brightnessLabel = lv_label_create(screens[SCREEN_LIGHT]);
     lv_label_set_text(brightnessLabel, "B");
     lv_obj_set_pos(brightnessLabel, 20, 50);
-    lv_obj_set_style_text_color(brightnessLabel, lv_color_white(), 0);
-    lv_obj_set_style_text_font(brightnessLabel, &lv_font_montserrat_48, 0);
+    lv_obj_add_style(brightnessLabel, &uiStyles.textLarge, 0);
     
     // Long brightness bar
     lightElements.brightnessBar = createBar(screens[SCREEN_LIGHT], 90, 50, 430, MIN_BRIGHTNESS, MAX_BRIGHTNESS, 50);
@@ -62,8 +80,7 @@ void ScreenManager::createLightScreen() {
     lv_obj_t* colorTempLabel = lv_label_create(screens[SCREEN_LIGHT]);
     lv_label_set_text(colorTempLabel, "C");
     lv_obj_set_pos(colorTempLabel, 20, 140);
-    lv_obj_set_style_text_color(colorTempLabel, lv_color_white(), 0);
-    lv_obj_set_style_text_font(colorTempLabel, &lv_font_montserrat_48, 0);
+    lv_obj_add_style(colorTempLabel, &uiStyles.textLarge, 0);
     
     // Long color temp bar
     lightElements.colorTempBar = createBar(screens[SCREEN_LIGHT], 90, 140, 430, MIN_COLOR_TEMP, MAX_COLOR_TEMP, 4000);
@@ -77,63 +94,99 @@ void ScreenManager::createLightScreen() {
     lv_obj_add_flag(lightElements.colorTempLabel, LV_OBJ_FLAG_HIDDEN);
     lightElements.powerButton = nullptr;
     
-    Serial.println("Light screen created with large B and C text");
+    LOG_I(TAG, "Light screen created with large B and C text");
 }
 
 void ScreenManager::createHVACScreen() {
     screens[SCREEN_HVAC] = lv_obj_create(screenContainer);
-    lv_obj_set_size(screens[SCREEN_HVAC], SCREEN_WIDTH, SCREEN_HEIGHT);
-    lv_obj_set_style_bg_color(screens[SCREEN_HVAC], lv_color_black(), 0);
-    lv_obj_set_style_border_width(screens[SCREEN_HVAC], 0, 0);
-    lv_obj_set_style_pad_all(screens[SCREEN_HVAC], 0, 0);
+    lv_obj_set_size(screens[SCREEN_HVAC], lv_disp_get_hor_res(NULL), lv_disp_get_ver_res(NULL));
+    lv_obj_add_style(screens[SCREEN_HVAC], &uiStyles.screen, 0);
     lv_obj_clear_flag(screens[SCREEN_HVAC], LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_add_flag(screens[SCREEN_HVAC], LV_OBJ_FLAG_HIDDEN);
     
     // Initialize target temperature to 22 if not set
-    if (hvacState.targetTemp < 16 || hvacState.targetTemp > 27) {
-        hvacState.targetTemp = 22.0;
+    if (shownHvac.targetTemp < 16 || shownHvac.targetTemp > 27) {
+        shownHvac.targetTemp = 22.0;
     }
     
     // OFF button at TOP LEFT
+    // Selected mode shows through LV_STATE_CHECKED
     hvacElements.offButton = createButton(screens[SCREEN_HVAC], "OFF", 150, 10, 100, 50);
-    lv_obj_set_style_bg_color(hvacElements.offButton, lv_color_hex(0x333333), 0);
-    lv_obj_set_style_text_color(lv_obj_get_child(hvacElements.offButton, 0), lv_color_white(), 0);
-    lv_obj_set_style_text_font(lv_obj_get_child(hvacElements.offButton, 0), &lv_font_montserrat_22, 0);
+    lv_obj_add_style(hvacElements.offButton, &uiStyles.buttonMode, 0);
+    lv_obj_add_style(hvacElements.offButton, &uiStyles.buttonOffChecked, LV_STATE_CHECKED);
     lv_obj_add_event_cb(hvacElements.offButton, hvacOffButtonEvent, LV_EVENT_CLICKED, this);
     
     // COOL button at TOP RIGHT
     hvacElements.coolButton = createButton(screens[SCREEN_HVAC], "COOL", 286, 10, 100, 50);
-    lv_obj_set_style_bg_color(hvacElements.coolButton, lv_color_hex(0x2196F3), 0);
-    lv_obj_set_style_text_color(lv_obj_get_child(hvacElements.coolButton, 0), lv_color_white(), 0);
-    lv_obj_set_style_text_font(lv_obj_get_child(hvacElements.coolButton, 0), &lv_font_montserrat_22, 0);
+    lv_obj_add_style(hvacElements.coolButton, &uiStyles.buttonMode, 0);
+    lv_obj_add_style(hvacElements.coolButton, &uiStyles.buttonCoolChecked, LV_STATE_CHECKED);
+    lv_obj_add_state(hvacElements.coolButton, LV_STATE_CHECKED);
     lv_obj_add_event_cb(hvacElements.coolButton, hvacCoolButtonEvent, LV_EVENT_CLICKED, this);
     
     // MINUS button on LEFT SIDE - TRUE FULL SCREEN HEIGHT
     hvacElements.tempDownButton = createButton(screens[SCREEN_HVAC], "-", 5, 5, 120, 230);
-    lv_obj_set_style_bg_color(hvacElements.tempDownButton, lv_color_hex(0x404040), 0);
-    lv_obj_set_style_text_color(lv_obj_get_child(hvacElements.tempDownButton, 0), lv_color_white(), 0);
-    lv_obj_set_style_text_font(lv_obj_get_child(hvacElements.tempDownButton, 0), &montserrat_96, 0);
+    lv_obj_add_style(hvacElements.tempDownButton, &uiStyles.buttonStep, 0);
     lv_obj_add_event_cb(hvacElements.tempDownButton, hvacTempDownButtonEvent, LV_EVENT_CLICKED, this);
     
     // PLUS button on RIGHT SIDE - TRUE FULL SCREEN HEIGHT
     hvacElements.tempUpButton = createButton(screens[SCREEN_HVAC], "+", 411, 5, 120, 230);
-    lv_obj_set_style_bg_color(hvacElements.tempUpButton, lv_color_hex(0x404040), 0);
-    lv_obj_set_style_text_color(lv_obj_get_child(hvacElements.tempUpButton, 0), lv_color_white(), 0);
-    lv_obj_set_style_text_font(lv_obj_get_child(hvacElements.tempUpButton, 0), &montserrat_96, 0);
+    lv_obj_add_style(hvacElements.tempUpButton, &uiStyles.buttonStep, 0);
     lv_obj_add_event_cb(hvacElements.tempUpButton, hvacTempUpButtonEvent, LV_EVENT_CLICKED, this);
     
     // Large target temperature display in center - show current target temp
     hvacElements.targetTempValueLabel = lv_label_create(screens[SCREEN_HVAC]);
-    char tempStr[8];
-    snprintf(tempStr, sizeof(tempStr), "%.0f", hvacState.targetTemp);
-    lv_label_set_text(hvacElements.targetTempValueLabel, tempStr);
-    lv_obj_set_pos(hvacElements.targetTempValueLabel, 220, 100);
-    lv_obj_set_style_text_color(hvacElements.targetTempValueLabel, lv_color_white(), 0);
-    lv_obj_set_style_text_font(hvacElements.targetTempValueLabel, &montserrat_96, 0);
+    lv_obj_align(hvacElements.targetTempValueLabel, LV_ALIGN_TOP_MID, 0, 100);
+    lv_obj_add_style(hvacElements.targetTempValueLabel, &uiStyles.textDigits, 0);
     
-    Serial.println("HVAC screen created with large temperature display");
-    Serial.print("Initial target temp: ");
-    Serial.println(hvacState.targetTemp);
+    // Every settable value pre-rendered, a tap only swaps the sprite
+    if (targetTempSprite.init(screens[SCREEN_HVAC], &montserrat_96, lv_color_white(), lv_color_black(),
+                              MIN_TEMPERATURE, MAX_TEMPERATURE)) {
+        lv_obj_align(targetTempSprite.getObj(), LV_ALIGN_TOP_MID, 0, 100);
+    }
+    showTargetTemp(shownHvac.targetTemp);
+    
+    // Only the target temperature stays lit in the idle view
+    setLiveRegion(SCREEN_HVAC, targetTempSprite.isReady() ? targetTempSprite.getObj()
+                                                          : hvacElements.targetTempValueLabel);
+    
+    LOG_I(TAG, "HVAC screen created with large temperature display");
+    LOG_I(TAG, "Initial target temp: %.1f", shownHvac.targetTemp);
+}
+
+void ScreenManager::createOverview() {
+    const lv_coord_t width = lv_disp_get_hor_res(NULL);
+    const lv_coord_t height = lv_disp_get_ver_res(NULL);
+    const lv_coord_t gap = 10;
+    const lv_coord_t tileWidth = (width - (SCREEN_COUNT + 1) * gap) / SCREEN_COUNT;
+    
+    overviewElements.container = lv_obj_create(screenContainer);
+    lv_obj_set_size(overviewElements.container, width, height);
+    lv_obj_add_style(overviewElements.container, &uiStyles.screen, 0);
+    lv_obj_clear_flag(overviewElements.container, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(overviewElements.container, LV_OBJ_FLAG_HIDDEN);
+    
+    // One tile per screen, tapping it opens that screen
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        lv_obj_t* tile = createButton(overviewElements.container, SCREEN_NAMES[i],
+                                      gap + i * (tileWidth + gap), gap, tileWidth, height - 2 * gap);
+        lv_obj_add_style(tile, &uiStyles.tile, 0);
+        lv_obj_set_user_data(tile, (void*)(intptr_t)i);
+        lv_obj_add_event_cb(tile, overviewTileEvent, LV_EVENT_CLICKED, this);
+        
+        // Title and detail take the tile's grey text
+        lv_obj_align(lv_obj_get_child(tile, 0), LV_ALIGN_TOP_MID, 0, 10);
+        
+        overviewElements.values[i] = lv_label_create(tile);
+        lv_label_set_text(overviewElements.values[i], "--");
+        lv_obj_add_style(overviewElements.values[i], &uiStyles.textLarge, 0);
+        lv_obj_align(overviewElements.values[i], LV_ALIGN_CENTER, 0, 0);
+        
+        overviewElements.details[i] = lv_label_create(tile);
+        lv_label_set_text(overviewElements.details[i], "");
+        lv_obj_align(overviewElements.details[i], LV_ALIGN_BOTTOM_MID, 0, -10);
+    }
+    
+    LOG_I(TAG, "Overview created");
 }
 
 lv_obj_t* ScreenManager::createButton(lv_obj_t* parent, const char* text, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h) {
@@ -152,8 +205,7 @@ lv_obj_t* ScreenManager::createLabel(lv_obj_t* parent, const char* text, lv_coor
     lv_obj_t* label = lv_label_create(parent);
     lv_label_set_text(label, text);
     lv_obj_set_pos(label, x, y);
-    lv_obj_set_style_text_color(label, lv_color_white(), 0);
-    lv_obj_set_style_text_font(label, &lv_font_montserrat_22, 0);
+    lv_obj_add_style(label, &uiStyles.textSmall, 0);
     return label;
 }
 
@@ -164,9 +216,8 @@ lv_obj_t* ScreenManager::createBar(lv_obj_t* parent, lv_coord_t x, lv_coord_t y,
     lv_obj_set_height(bar, 60);
     lv_bar_set_range(bar, min_val, max_val);
     lv_bar_set_value(bar, default_val, LV_ANIM_OFF);
-    lv_obj_set_style_bg_color(bar, lv_color_hex(0x333333), LV_PART_MAIN);
-    lv_obj_set_style_bg_color(bar, lv_color_hex(0xFF9500), LV_PART_INDICATOR);
-    lv_obj_set_style_border_width(bar, 0, LV_PART_MAIN);
+    lv_obj_add_style(bar, &uiStyles.barMain, LV_PART_MAIN);
+    lv_obj_add_style(bar, &uiStyles.barIndicator, LV_PART_INDICATOR);
     
     lv_obj_add_flag(bar, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_clear_flag(bar, LV_OBJ_FLAG_GESTURE_BUBBLE);
@@ -184,13 +235,13 @@ void ScreenManager::showScreen(ScreenType screen) {
             lv_obj_add_flag(screens[i], LV_OBJ_FLAG_HIDDEN);
         }
     }
+    hideOverview();
     
     if (screens[screen]) {
         lv_obj_clear_flag(screens[screen], LV_OBJ_FLAG_HIDDEN);
         currentScreen = screen;
         
-        Serial.print("Switched to screen: ");
-        Serial.println(SCREEN_NAMES[screen]);
+        LOG_I(TAG, "Switched to screen: %s", SCREEN_NAMES[screen]);
         
         if (screen == SCREEN_LIGHT) {
             updateLightStatus();
@@ -200,6 +251,16 @@ void ScreenManager::showScreen(ScreenType screen) {
     }
 }
 
+void ScreenManager::requestScreen(ScreenType screen) {
+    UiUpdate msg;
+    msg.type = UI_UPDATE_SHOW_SCREEN;
+    msg.screen = screen;
+    
+    if (!uiQueue.push(msg)) {
+        LOG_W(TAG, "UI queue full, screen change dropped");
+    }
+}
+
 void ScreenManager::nextScreen() {
     ScreenType nextScreen = (ScreenType)((currentScreen + 1) % SCREEN_COUNT);
     showScreen(nextScreen);
@@ -210,63 +271,295 @@ void ScreenManager::previousScreen() {
     showScreen(prevScreen);
 }
 
-void ScreenManager::setupGestureHandling() {
-    lv_obj_add_event_cb(screenContainer, gestureEventHandler, LV_EVENT_GESTURE, this);
+void ScreenManager::showOverview() {
+    if (!screensCreated || overviewActive) {
+        return;
+    }
     
-    for (int i = 0; i < SCREEN_COUNT; i++) {
-        if (screens[i]) {
-            lv_obj_add_event_cb(screens[i], gestureEventHandler, LV_EVENT_GESTURE, this);
-        }
+    updateOverview();
+    lv_obj_clear_flag(overviewElements.container, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(screens[currentScreen], LV_OBJ_FLAG_HIDDEN);
+    overviewActive = true;
+    
+    LOG_I(TAG, "Switched to overview");
+}
+
+void ScreenManager::hideOverview() {
+    if (overviewActive) {
+        lv_obj_add_flag(overviewElements.container, LV_OBJ_FLAG_HIDDEN);
+        overviewActive = false;
+    }
+}
+
+void ScreenManager::updateOverview() {
+    if (!overviewElements.container) return;
+    
+    char text[16];
+    if (shownLight.available) {
+        snprintf(text, sizeof(text), "%d%%", shownLight.brightness);
+        lv_label_set_text(overviewElements.values[SCREEN_LIGHT], text);
+        snprintf(text, sizeof(text), "%dK", shownLight.colorTemp);
+        lv_label_set_text(overviewElements.details[SCREEN_LIGHT], text);
+    }
+    if (shownHvac.available) {
+        snprintf(text, sizeof(text), "%.0f", shownHvac.targetTemp);
+        lv_label_set_text(overviewElements.values[SCREEN_HVAC], text);
+        lv_label_set_text(overviewElements.details[SCREEN_HVAC], shownHvac.isOn ? shownHvac.mode : "off");
     }
 }
 
-void ScreenManager::gestureEventHandler(lv_event_t* e) {
+void ScreenManager::overviewTileEvent(lv_event_t* e) {
     ScreenManager* mgr = (ScreenManager*)lv_event_get_user_data(e);
-    lv_dir_t dir = lv_indev_get_gesture_dir(lv_indev_get_act());
+    ScreenType screen = (ScreenType)(intptr_t)lv_obj_get_user_data(lv_event_get_target(e));
+    mgr->showScreen(screen);
+}
+
+void ScreenManager::setupGestureHandling() {
+    gestureSetHandler(gestureHandler, this);
+}
+
+void ScreenManager::gestureHandler(const GestureEvent& event, void* ctx) {
+    ((ScreenManager*)ctx)->onGesture(event);
+}
+
+void ScreenManager::onGesture(const GestureEvent& event) {
+    const lv_coord_t height = lv_disp_get_ver_res(NULL);
+    
+    switch (event.type) {
+        case GESTURE_SWIPE_INTENT: {
+            // A touch that wakes the idle view only wakes it
+            if (idleViewActive || overviewActive) {
+                gestureCancel();
+                return;
+            }
+            if (swipeActive) {
+                // caught a screen that was still settling
+                lv_anim_del(this, swipeAnimCb);
+                finishSwipe();
+            }
+            
+            swipeDir = event.dir;
+            swipeTarget = (ScreenType)(event.dir == LV_DIR_TOP ? (currentScreen + 1) % SCREEN_COUNT
+                                                              : (currentScreen - 1 + SCREEN_COUNT) % SCREEN_COUNT);
+            swipeActive = true;
+            lv_obj_clear_flag(screens[swipeTarget], LV_OBJ_FLAG_HIDDEN);
+            setSwipeOffset(event.dy);
+            
+            // The finger now drives the screens, not the widget under it
+            lv_indev_t* indev = lv_indev_get_act();
+            if (indev) {
+                lv_indev_wait_release(indev);
+            }
+            
+            LOG_I(TAG, "Swipe %s", event.dir == LV_DIR_TOP ? "UP - next screen" : "DOWN - previous screen");
+            break;
+        }
+        
+        case GESTURE_DRAG:
+            if (swipeActive) {
+                setSwipeOffset(event.dy);
+            }
+            break;
+        
+        case GESTURE_RELEASE: {
+            if (!swipeActive) return;
+            
+            // Carry on with the release velocity and settle on whichever screen that reaches
+            const float projected = event.dy + event.vy * (GESTURE_FLING_MS / 1000.0f);
+            const lv_coord_t target = swipeDir == LV_DIR_TOP ? -height : height;
+            swipeCommit = swipeDir == LV_DIR_TOP ? projected < -height / 3 : projected > height / 3;
+            
+            const lv_coord_t start = swipeDir == LV_DIR_TOP ? LV_CLAMP(-height, event.dy, 0) : LV_CLAMP(0, event.dy, height);
+            const lv_coord_t end = swipeCommit ? target : 0;
+            const float speed = LV_MAX(fabsf(event.vy), 600.0f);
+            const uint32_t ms = LV_CLAMP(80, (uint32_t)(abs(end - start) * 1000.0f / speed), 350);
+            
+            lv_anim_t anim;
+            lv_anim_init(&anim);
+            lv_anim_set_var(&anim, this);
+            lv_anim_set_exec_cb(&anim, swipeAnimCb);
+            lv_anim_set_values(&anim, start, end);
+            lv_anim_set_time(&anim, ms);
+            lv_anim_set_path_cb(&anim, lv_anim_path_ease_out);
+            lv_anim_set_ready_cb(&anim, swipeAnimReadyCb);
+            lv_anim_start(&anim);
+            break;
+        }
+        
+        case GESTURE_PINCH_IN:
+        case GESTURE_PINCH_OUT: {
+            if (idleViewActive) return;
+            
+            // Neither finger should press what is under it
+            lv_indev_t* indev = lv_indev_get_act();
+            if (indev) {
+                lv_indev_wait_release(indev);
+            }
+            
+            // Pinch in zooms out to every entity, pinch out back into the last screen
+            if (event.type == GESTURE_PINCH_IN && !overviewActive && !swipeActive) {
+                showOverview();
+            } else if (event.type == GESTURE_PINCH_OUT && overviewActive) {
+                showScreen(currentScreen);
+            }
+            break;
+        }
+    }
+}
+
+void ScreenManager::setSwipeOffset(lv_coord_t offset) {
+    const lv_coord_t height = lv_disp_get_ver_res(NULL);
+    
+    // Finger up brings the next screen in from below, finger down the previous one from above
+    if (swipeDir == LV_DIR_TOP) {
+        offset = LV_CLAMP(-height, offset, 0);
+        lv_obj_set_y(screens[swipeTarget], offset + height);
+    } else {
+        offset = LV_CLAMP(0, offset, height);
+        lv_obj_set_y(screens[swipeTarget], offset - height);
+    }
+    lv_obj_set_y(screens[currentScreen], offset);
+}
+
+void ScreenManager::swipeAnimCb(void* var, int32_t offset) {
+    ((ScreenManager*)var)->setSwipeOffset(offset);
+}
+
+void ScreenManager::swipeAnimReadyCb(lv_anim_t* anim) {
+    ((ScreenManager*)anim->var)->finishSwipe();
+}
+
+void ScreenManager::finishSwipe() {
+    swipeActive = false;
+    lv_obj_set_y(screens[currentScreen], 0);
+    lv_obj_set_y(screens[swipeTarget], 0);
+    
+    if (swipeCommit) {
+        showScreen(swipeTarget);
+    } else {
+        lv_obj_add_flag(screens[swipeTarget], LV_OBJ_FLAG_HIDDEN);
+    }
+    swipeCommit = false;
+}
+
+void ScreenManager::setLiveRegion(ScreenType screen, lv_obj_t* obj) {
+    if (screen < SCREEN_COUNT) {
+        liveRegions[screen] = obj;
+    }
+}
+
+void ScreenManager::idleViewTimerCb(lv_timer_t* timer) {
+    ScreenManager* mgr = (ScreenManager*)timer->user_data;
+    bool idle = lv_disp_get_inactive_time(NULL) >= DISPLAY_IDLE_VIEW_TIMEOUT_MS;
+    
+    if (idle && !mgr->idleViewActive) {
+        mgr->enterIdleView();
+    } else if (!idle && mgr->idleViewActive) {
+        mgr->exitIdleView();
+    }
+}
+
+void ScreenManager::enterIdleView() {
+    lv_obj_t* live = liveRegions[currentScreen];
+    if (!live || overviewActive) return;
+    
+    lv_area_t coords;
+    lv_obj_get_coords(live, &coords);
+    if (displaySetActiveBand(coords.y1, coords.y2)) {
+        idleViewActive = true;
+        LOG_I(TAG, "Idle view on, live rows: %d-%d", (int)coords.y1, (int)coords.y2);
+    }
+}
+
+void ScreenManager::exitIdleView() {
+    displayClearActiveBand();
+    idleViewActive = false;
+    
+    // The touch that woke the panel should not also press a button
+    lv_indev_t* indev = lv_indev_get_next(NULL);
+    if (indev) {
+        lv_indev_wait_release(indev);
+    }
     
-    Serial.print("Gesture detected: ");
-    Serial.println(dir);
+    LOG_I(TAG, "Idle view off");
+}
+
+void ScreenManager::uiQueueTimerCb(lv_timer_t* timer) {
+    ScreenManager* mgr = (ScreenManager*)timer->user_data;
+    UiUpdate latest[UI_UPDATE_TYPE_COUNT];
+    bool pending[UI_UPDATE_TYPE_COUNT] = {};
+    
+    // Messages carry the whole state, so only the newest of each type matters
+    UiUpdate msg;
+    while (uiQueue.pop(msg)) {
+        latest[msg.type] = msg;
+        pending[msg.type] = true;
+    }
     
-    if (dir == LV_DIR_TOP) {
-        Serial.println("Swipe UP detected - next screen");
-        mgr->nextScreen();
-    } else if (dir == LV_DIR_BOTTOM) {
-        Serial.println("Swipe DOWN detected - previous screen");  
-        mgr->previousScreen();
+    if (pending[UI_UPDATE_LIGHT]) {
+        mgr->shownLight = latest[UI_UPDATE_LIGHT].light;
+        mgr->updateLightStatus();
+    }
+    if (pending[UI_UPDATE_HVAC]) {
+        mgr->shownHvac = latest[UI_UPDATE_HVAC].hvac;
+        mgr->updateHVACStatus();
+    }
+    // A swipe in progress already decides the screen
+    if (pending[UI_UPDATE_SHOW_SCREEN] && !mgr->swipeActive) {
+        mgr->showScreen(latest[UI_UPDATE_SHOW_SCREEN].screen);
     }
 }
 
 void ScreenManager::updateLightStatus() {
     if (!lightElements.brightnessBar) return;
     
-    if (lightState.available) {
-        lv_bar_set_value(lightElements.brightnessBar, lightState.brightness, LV_ANIM_OFF);
-        lv_bar_set_value(lightElements.colorTempBar, lightState.colorTemp, LV_ANIM_OFF);
+    if (shownLight.available) {
+        lv_bar_set_value(lightElements.brightnessBar, shownLight.brightness, LV_ANIM_OFF);
+        lv_bar_set_value(lightElements.colorTempBar, shownLight.colorTemp, LV_ANIM_OFF);
+    }
+    if (overviewActive) {
+        updateOverview();
+    }
+}
+
+static void setChecked(lv_obj_t* obj, bool checked) {
+    if (checked) {
+        lv_obj_add_state(obj, LV_STATE_CHECKED);
+    } else {
+        lv_obj_clear_state(obj, LV_STATE_CHECKED);
     }
 }
 
 void ScreenManager::updateHVACStatus() {
     if (!hvacElements.offButton) return;
     
-    if (hvacState.available) {
-        if (hvacState.mode == "off" || hvacState.mode == "" || !hvacState.isOn) {
-            lv_obj_set_style_bg_color(hvacElements.offButton, lv_color_hex(0x666666), 0);
-            lv_obj_set_style_bg_color(hvacElements.coolButton, lv_color_hex(0x333333), 0);
-        } else if (hvacState.mode == "cool") {
-            lv_obj_set_style_bg_color(hvacElements.offButton, lv_color_hex(0x333333), 0);
-            lv_obj_set_style_bg_color(hvacElements.coolButton, lv_color_hex(0x2196F3), 0);
-        } else {
-            lv_obj_set_style_bg_color(hvacElements.offButton, lv_color_hex(0x333333), 0);
-            lv_obj_set_style_bg_color(hvacElements.coolButton, lv_color_hex(0x333333), 0);
-        }
+    if (shownHvac.available) {
+        // Only a state that actually changes restyles and invalidates the button
+        const bool off = strcmp(shownHvac.mode, "off") == 0 || shownHvac.mode[0] == '\0' || !shownHvac.isOn;
+        setChecked(hvacElements.offButton, off);
+        setChecked(hvacElements.coolButton, !off && strcmp(shownHvac.mode, "cool") == 0);
         
         // Update the target temperature display
-        if (hvacElements.targetTempValueLabel) {
-            char tempStr[8];
-            snprintf(tempStr, sizeof(tempStr), "%.0f", hvacState.targetTemp);
-            lv_label_set_text(hvacElements.targetTempValueLabel, tempStr);
-        }
+        showTargetTemp(shownHvac.targetTemp);
+    }
+    if (overviewActive) {
+        updateOverview();
+    }
+}
+
+void ScreenManager::showTargetTemp(float temp) {
+    if (!hvacElements.targetTempValueLabel) return;
+    
+    // Rounds like "%.0f", so sprite and label agree
+    if (targetTempSprite.setValue((int)lrintf(temp))) {
+        lv_obj_add_flag(hvacElements.targetTempValueLabel, LV_OBJ_FLAG_HIDDEN);
+        return;
     }
+    
+    char tempStr[8];
+    snprintf(tempStr, sizeof(tempStr), "%.0f", temp);
+    lv_label_set_text(hvacElements.targetTempValueLabel, tempStr);
+    lv_obj_clear_flag(hvacElements.targetTempValueLabel, LV_OBJ_FLAG_HIDDEN);
 }
 
 void ScreenManager::update() {
@@ -324,55 +617,43 @@ void ScreenManager::hvacCoolButtonEvent(lv_event_t* e) {
 }
 
 void ScreenManager::hvacTempUpButtonEvent(lv_event_t* e) {
-    float currentTemp = hvacState.targetTemp;
-    float newTemp = hvacState.targetTemp + 1.0f;
+    if (!instance) return;
+    float currentTemp = instance->shownHvac.targetTemp;
+    float newTemp = currentTemp + 1.0f;
     if (newTemp <= 27) {  // Max temp 27
         // Update local state immediately
-        hvacState.targetTemp = newTemp;
+        instance->shownHvac.targetTemp = newTemp;
         
         // Send MQTT command
         mqttHandler.setHVACTemperature(newTemp);
         
         // Update the display immediately
-        if (instance && instance->hvacElements.targetTempValueLabel) {
-            char tempStr[8];
-            snprintf(tempStr, sizeof(tempStr), "%.0f", newTemp);
-            lv_label_set_text(instance->hvacElements.targetTempValueLabel, tempStr);
-        }
+        instance->showTargetTemp(newTemp);
         
         // Debug output
-        Serial.print("HVAC Temp UP pressed: ");
-        Serial.print(currentTemp);
-        Serial.print(" -> ");
-        Serial.println(newTemp);
+        LOG_I(TAG, "HVAC Temp UP pressed: %.1f -> %.1f", currentTemp, newTemp);
     } else {
-        Serial.println("Cannot go higher than 27°");
+        LOG_I(TAG, "Cannot go higher than 27°");
     }
 }
 
 void ScreenManager::hvacTempDownButtonEvent(lv_event_t* e) {
-    float currentTemp = hvacState.targetTemp;
-    float newTemp = hvacState.targetTemp - 1.0f;
+    if (!instance) return;
+    float currentTemp = instance->shownHvac.targetTemp;
+    float newTemp = currentTemp - 1.0f;
     if (newTemp >= 16) {  // Min temp 16
         // Update local state immediately
-        hvacState.targetTemp = newTemp;
+        instance->shownHvac.targetTemp = newTemp;
         
         // Send MQTT command
         mqttHandler.setHVACTemperature(newTemp);
         
         // Update the display immediately
-        if (instance && instance->hvacElements.targetTempValueLabel) {
-            char tempStr[8];
-            snprintf(tempStr, sizeof(tempStr), "%.0f", newTemp);
-            lv_label_set_text(instance->hvacElements.targetTempValueLabel, tempStr);
-        }
+        instance->showTargetTemp(newTemp);
         
         // Debug output
-        Serial.print("HVAC Temp DOWN pressed: ");
-        Serial.print(currentTemp);
-        Serial.print(" -> ");
-        Serial.println(newTemp);
+        LOG_I(TAG, "HVAC Temp DOWN pressed: %.1f -> %.1f", currentTemp, newTemp);
     } else {
-        Serial.println("Cannot go lower than 16°");
+        LOG_I(TAG, "Cannot go lower than 16°");
     }
 }
\ No newline at end of file
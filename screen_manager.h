@@ -3,6 +3,9 @@
 
 #include <lvgl.h>
 #include "config.h"
+#include "ui_queue.h"
+#include "gesture.h"
+#include "numeric_sprite.h"
 
 // Forward declarations
 class MQTTHandler;
@@ -24,18 +27,31 @@ struct HVACElements {
     lv_obj_t* targetTempValueLabel = nullptr;
 };
 
+// Compact view with one tile per screen, reached with a pinch
+struct OverviewElements {
+    lv_obj_t* container = nullptr;
+    lv_obj_t* values[SCREEN_COUNT] = {};
+    lv_obj_t* details[SCREEN_COUNT] = {};
+};
+
 class ScreenManager {
 public:
     void init();
     void showScreen(ScreenType screen);
+    // showScreen() for callers outside the LVGL task, applied by the UI queue timer
+    void requestScreen(ScreenType screen);
     void nextScreen();
     void previousScreen();
+    void showOverview();
     void updateLightStatus();
     void updateHVACStatus();
     void update();
     
     ScreenType getCurrentScreen() const { return currentScreen; }
     
+    // Declare the object whose rows stay lit in the idle view of a screen
+    void setLiveRegion(ScreenType screen, lv_obj_t* obj);
+    
     // Static callback functions
     static void lightPowerButtonEvent(lv_event_t* e);
     static void brightnessBarEvent(lv_event_t* e);
@@ -44,23 +60,52 @@ public:
     static void hvacCoolButtonEvent(lv_event_t* e);
     static void hvacTempUpButtonEvent(lv_event_t* e);
     static void hvacTempDownButtonEvent(lv_event_t* e);
-    static void gestureEventHandler(lv_event_t* e);
+    static void overviewTileEvent(lv_event_t* e);
+    static void gestureHandler(const GestureEvent& event, void* ctx);
+    static void swipeAnimCb(void* var, int32_t offset);
+    static void swipeAnimReadyCb(lv_anim_t* anim);
+    static void idleViewTimerCb(lv_timer_t* timer);
+    static void uiQueueTimerCb(lv_timer_t* timer);
     
     static ScreenManager* instance;
     
     LightElements lightElements;
     HVACElements hvacElements;
+    OverviewElements overviewElements;
+    NumericSprite targetTempSprite;     // replaces targetTempValueLabel when it fits in PSRAM
 
 private:
     lv_obj_t* screenContainer = nullptr;
     lv_obj_t* screens[SCREEN_COUNT];
+    lv_obj_t* liveRegions[SCREEN_COUNT];
     ScreenType currentScreen = SCREEN_LIGHT;
     bool screensCreated = false;
+    bool idleViewActive = false;
+    bool overviewActive = false;
+    
+    // State shown by the widgets, only touched on the LVGL task
+    UiLightSnapshot shownLight = {false, false, 50, 4000};
+    UiHvacSnapshot shownHvac = {false, false, 20.0f, 22.0f, "off"};
+    
+    // Screen switch that follows the finger, then settles with the fling
+    bool swipeActive = false;
+    bool swipeCommit = false;
+    lv_dir_t swipeDir = LV_DIR_NONE;
+    ScreenType swipeTarget = SCREEN_LIGHT;
     
     void createAllScreens();
     void createLightScreen();
     void createHVACScreen();
+    void createOverview();
+    void showTargetTemp(float temp);
+    void hideOverview();
+    void updateOverview();
     void setupGestureHandling();
+    void onGesture(const GestureEvent& event);
+    void setSwipeOffset(lv_coord_t offset);
+    void finishSwipe();
+    void enterIdleView();
+    void exitIdleView();
     
     // Helper functions for creating UI elements
     lv_obj_t* createButton(lv_obj_t* parent, const char* text, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h);
@@ -0,0 +1,73 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "te_pacing.h"
+
+#define MAX_PERIOD_US       100000
+#define MIN_PACING_EDGES    8
+
+void te_pacing_init(te_pacing_t *p, uint32_t nominal_period_us)
+{
+    memset(p, 0, sizeof(*p));
+    p->period_us = nominal_period_us;
+}
+
+void te_pacing_edge(te_pacing_t *p, int64_t now_us)
+{
+    if (p->last_edge_us != 0) {
+        int32_t period = (int32_t)(now_us - p->last_edge_us);
+        if (period > 0 && period < MAX_PERIOD_US) {
+            const int32_t avg = (int32_t)p->period_us;
+            const int32_t jitter = (int32_t)p->jitter_us;
+            // Once the average has settled, an interval of two or more periods
+            // means edges went unsignalled; average it as that many periods
+            if (p->edges >= MIN_PACING_EDGES && period > avg + avg / 2) {
+                period /= (period + avg / 2) / avg;
+            }
+            p->period_us = avg + (period - avg) / 8;
+            p->jitter_us = jitter + (abs(period - avg) - jitter) / 8;
+        }
+    }
+    p->last_edge_us = now_us;
+    p->edges++;
+}
+
+uint32_t te_pacing_wait_us(const te_pacing_t *p, int64_t now_us)
+{
+    if (now_us - p->last_edge_us <= p->period_us / 4) {
+        return 0;
+    }
+    return 2 * p->period_us;
+}
+
+void te_pacing_frame_start(te_pacing_t *p, int64_t now_us, bool edge_seen)
+{
+    if (!edge_seen) {
+        p->wait_timeouts++;
+    }
+    const int32_t latency = (int32_t)(now_us - p->last_edge_us);
+    p->start_latency_us = (int32_t)p->start_latency_us + (latency - (int32_t)p->start_latency_us) / 8;
+    p->frame_start_edge_us = p->last_edge_us;
+    p->frame_active = true;
+}
+
+void te_pacing_frame_done(te_pacing_t *p)
+{
+    if (!p->frame_active) {
+        return;
+    }
+    p->frames++;
+    // The panel started scanning out a new frame while we were still writing
+    if (p->last_edge_us != p->frame_start_edge_us) {
+        p->missed_deadlines++;
+    }
+    p->frame_active = false;
+}
+
+uint32_t te_pacing_refresh_period_ms(const te_pacing_t *p)
+{
+    if (p->edges < MIN_PACING_EDGES) {
+        return 0;
+    }
+    return (p->period_us + 500) / 1000;
+}
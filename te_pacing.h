@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Frame pacing state of the tearing-effect scheduler
+ *
+ * @note  Free of any ESP-IDF dependency so it can be driven by a simulated TE source. te_sync.cpp owns one
+ *        instance and calls every function below under its spinlock.
+ */
+typedef struct {
+    int64_t last_edge_us;
+    int64_t frame_start_edge_us;    /*!< Edge the current flush frame started on */
+    bool frame_active;
+    uint32_t edges;
+    uint32_t period_us;             /*!< Measured panel refresh period, moving average */
+    uint32_t jitter_us;             /*!< Mean deviation of the period */
+    uint32_t start_latency_us;      /*!< Edge to frame start, moving average */
+    uint32_t frames;
+    uint32_t missed_deadlines;      /*!< Frames still on the wire when the next edge came */
+    uint32_t wait_timeouts;         /*!< No edge seen within two periods */
+} te_pacing_t;
+
+/**
+ * @brief Reset the pacing state, starting from an expected period
+ */
+void te_pacing_init(te_pacing_t *p, uint32_t nominal_period_us);
+
+/**
+ * @brief Feed one TE edge
+ *
+ * @note  Intervals of 100 ms or more (a stalled or restarted source) are not averaged into the period. Once
+ *        the average has settled, an interval of about n periods counts as n, so a dropped edge does not
+ *        stretch the period LVGL's refresh is paced to.
+ */
+void te_pacing_edge(te_pacing_t *p, int64_t now_us);
+
+/**
+ * @brief How long a flush frame about to start should wait for the next edge
+ *
+ * @return 0 if the last edge is less than a quarter period ago, so starting now is as good as starting on
+ *         the edge; otherwise the timeout to wait with, two periods
+ */
+uint32_t te_pacing_wait_us(const te_pacing_t *p, int64_t now_us);
+
+/**
+ * @brief Mark the start of a flush frame
+ *
+ * @param[in] edge_seen false if the wait for an edge timed out
+ */
+void te_pacing_frame_start(te_pacing_t *p, int64_t now_us, bool edge_seen);
+
+/**
+ * @brief Mark the end of a flush frame, counting it as missed if an edge came since it started
+ */
+void te_pacing_frame_done(te_pacing_t *p);
+
+/**
+ * @brief Measured period rounded to whole ms, 0 until enough edges were seen to trust it
+ */
+uint32_t te_pacing_refresh_period_ms(const te_pacing_t *p);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,158 @@
+#include "te_sync.h"
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "log_ring.h"
+#include "te_pacing.h"
+
+static const char *TAG = "te_sync";
+
+#define NOMINAL_PERIOD_US   16667
+
+static SemaphoreHandle_t edgeSem = NULL;
+static portMUX_TYPE teLock = portMUX_INITIALIZER_UNLOCKED;
+static bool enabled = false;
+// Deadlines and averages live in te_pacing.c, always touched under teLock
+static te_pacing_t pacing;
+
+#if EXAMPLE_PIN_NUM_LCD_TE >= 0
+static void teGpioIsr(void *arg) {
+    bool taskWoken = false;
+    teSyncOnEdge(esp_timer_get_time(), &taskWoken);
+    if (taskWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+#elif DISPLAY_TE_SIMULATE
+static esp_timer_handle_t simTimer = NULL;
+
+static void teSimTimerCb(void *arg) {
+    teSyncOnEdge(esp_timer_get_time(), NULL);
+}
+#endif
+
+bool teSyncInit() {
+    edgeSem = xSemaphoreCreateBinary();
+    if (!edgeSem) {
+        LOG_E(TAG, "Failed to create TE semaphore!");
+        return false;
+    }
+    te_pacing_init(&pacing, NOMINAL_PERIOD_US);
+
+#if EXAMPLE_PIN_NUM_LCD_TE >= 0
+    gpio_config_t io_conf = {};
+    io_conf.pin_bit_mask = 1ULL << EXAMPLE_PIN_NUM_LCD_TE;
+    io_conf.mode = GPIO_MODE_INPUT;
+    io_conf.intr_type = GPIO_INTR_POSEDGE;
+    ESP_ERROR_CHECK(gpio_config(&io_conf));
+
+    // The ISR service may already be installed by another driver
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        LOG_E(TAG, "TE ISR service install failed: %d", ret);
+        return false;
+    }
+    ESP_ERROR_CHECK(gpio_isr_handler_add((gpio_num_t)EXAMPLE_PIN_NUM_LCD_TE, teGpioIsr, NULL));
+    LOG_I(TAG, "Flush synchronized to TE on GPIO %d", EXAMPLE_PIN_NUM_LCD_TE);
+    enabled = true;
+#elif DISPLAY_TE_SIMULATE
+    esp_timer_create_args_t timer_args = {};
+    timer_args.callback = teSimTimerCb;
+    timer_args.name = "te_sim";
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &simTimer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(simTimer, DISPLAY_TE_SIM_PERIOD_US));
+    te_pacing_init(&pacing, DISPLAY_TE_SIM_PERIOD_US);
+    LOG_I(TAG, "Flush synchronized to simulated TE, %d us", DISPLAY_TE_SIM_PERIOD_US);
+    enabled = true;
+#endif
+
+    return enabled;
+}
+
+bool teSyncEnabled() {
+    return enabled;
+}
+
+void teSyncOnEdge(int64_t nowUs, bool *taskWoken) {
+    portENTER_CRITICAL_SAFE(&teLock);
+    te_pacing_edge(&pacing, nowUs);
+    portEXIT_CRITICAL_SAFE(&teLock);
+
+    if (xPortInIsrContext()) {
+        BaseType_t highPriorityTaskWoken = pdFALSE;
+        xSemaphoreGiveFromISR(edgeSem, &highPriorityTaskWoken);
+        if (taskWoken) {
+            *taskWoken = (highPriorityTaskWoken == pdTRUE);
+        }
+    } else {
+        xSemaphoreGive(edgeSem);
+    }
+}
+
+bool teSyncWaitForEdge() {
+    if (!enabled) {
+        return true;
+    }
+
+    portENTER_CRITICAL(&teLock);
+    const uint32_t timeoutUs = te_pacing_wait_us(&pacing, esp_timer_get_time());
+    portEXIT_CRITICAL(&teLock);
+
+    bool ok = true;
+    if (timeoutUs > 0) {
+        xSemaphoreTake(edgeSem, 0);     // drop an edge that has already passed
+        if (xSemaphoreTake(edgeSem, pdMS_TO_TICKS(timeoutUs / 1000 + 1)) != pdTRUE) {
+            ok = false;
+        }
+    }
+
+    portENTER_CRITICAL(&teLock);
+    te_pacing_frame_start(&pacing, esp_timer_get_time(), ok);
+    portEXIT_CRITICAL(&teLock);
+
+    return ok;
+}
+
+void teSyncFrameDone() {
+    if (!enabled) {
+        return;
+    }
+
+    portENTER_CRITICAL_SAFE(&teLock);
+    te_pacing_frame_done(&pacing);
+    portEXIT_CRITICAL_SAFE(&teLock);
+}
+
+uint32_t teSyncGetRefreshPeriodMs() {
+    if (!enabled) {
+        return 0;
+    }
+
+    portENTER_CRITICAL(&teLock);
+    const uint32_t periodMs = te_pacing_refresh_period_ms(&pacing);
+    portEXIT_CRITICAL(&teLock);
+    return periodMs;
+}
+
+uint32_t teSyncGetPeriodUs() {
+    portENTER_CRITICAL(&teLock);
+    uint32_t period = pacing.period_us;
+    portEXIT_CRITICAL(&teLock);
+    return period;
+}
+
+TeSyncStats getTeSyncStats() {
+    TeSyncStats snapshot;
+    portENTER_CRITICAL(&teLock);
+    snapshot.edges = pacing.edges;
+    snapshot.periodUs = pacing.period_us;
+    snapshot.jitterUs = pacing.jitter_us;
+    snapshot.startLatencyUs = pacing.start_latency_us;
+    snapshot.frames = pacing.frames;
+    snapshot.missedDeadlines = pacing.missed_deadlines;
+    snapshot.waitTimeouts = pacing.wait_timeouts;
+    portEXIT_CRITICAL(&teLock);
+    return snapshot;
+}
@@ -0,0 +1,43 @@
+#ifndef TE_SYNC_H
+#define TE_SYNC_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// Frame pacing statistics for the tearing-effect scheduler
+struct TeSyncStats {
+    uint32_t edges = 0;
+    uint32_t periodUs = 0;          // measured panel refresh period
+    uint32_t jitterUs = 0;          // mean deviation of the period
+    uint32_t startLatencyUs = 0;    // edge to first RAMWR, running average
+    uint32_t frames = 0;
+    uint32_t missedDeadlines = 0;   // frames still on the wire when the next edge came
+    uint32_t waitTimeouts = 0;      // no edge seen within two periods
+};
+
+// Starts listening to the TE pin, or to a timer that simulates it when
+// DISPLAY_TE_SIMULATE is set. Returns false if no TE source is available;
+// the scheduler then never waits.
+bool teSyncInit();
+bool teSyncEnabled();
+
+// Feeds one TE edge into the scheduler. Called by the GPIO ISR or the
+// simulated source, and safe to drive from any other source as well.
+void teSyncOnEdge(int64_t nowUs, bool *taskWoken);
+
+// Blocks until the start of the next panel frame, or returns right away
+// if an edge has just passed. Marks the start of a flush frame.
+bool teSyncWaitForEdge();
+
+// Marks the end of a flush frame (ISR safe) and counts it as missed if
+// the next edge came before it finished.
+void teSyncFrameDone();
+
+// Measured panel period rounded to whole ms, 0 until enough edges were
+// seen. The refresh governor paces LVGL's refresh timer to it.
+uint32_t teSyncGetRefreshPeriodMs();
+
+uint32_t teSyncGetPeriodUs();
+TeSyncStats getTeSyncStats();
+
+#endif
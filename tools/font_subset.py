@@ -0,0 +1,359 @@
+#!/usr/bin/env python3
+"""Trim the sketch's lv_font_conv fonts to the glyphs the UI draws.
+
+The glyph set of each font is the union of
+  - literal text the sources put on objects styled with that font, found by
+    following lv_obj_set_style_text_font(), or lv_obj_add_style() with a
+    shared style whose font ui_styles.cpp sets, back to createButton(),
+    createLabel() and lv_label_set_text() calls on the same object, and
+  - the "extra" characters tools/font_manifest.json lists for text that is
+    only known at run time (formatted numbers).
+
+Usage, from the sketch folder:
+  tools/font_subset.py            report what would be kept and saved
+  tools/font_subset.py --write    rewrite the font files and lv_conf.h
+  tools/font_subset.py --check    fail if a font lacks a glyph the UI needs
+
+--write renumbers the glyphs and replaces the cmap with a sparse one. A font
+with "compress": "rle1" in the manifest stores each glyph as LEB128 run
+lengths of alternating clear and set bits and draws through
+glyphCacheGetBitmap() (glyph_cache.cpp), which decodes into an LRU cache.
+The tool can only remove glyphs: to add one back, regenerate the full font
+with the lv_font_conv command from the file's "Source:" line and run the
+tool again. A font it wrote names it on its "Opts:" line.
+Built-in Montserrat sizes that no source references are switched off in
+lv_conf.h.
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MANIFEST = os.path.join(ROOT, "tools", "font_manifest.json")
+LV_CONF = os.path.join(ROOT, "lv_conf.h")
+# What a rewritten font's "Opts:" line says produced it
+SUBSET_COMMAND = "tools/font_subset.py --write"
+
+GLYPH_DSC_BYTES = 8         # lv_font_fmt_txt_glyph_dsc_t
+UNICODE_LIST_ENTRY_BYTES = 2
+
+FONT_STYLE_RE = re.compile(r"lv_obj_set_style_text_font\(\s*(.+?)\s*,\s*&(\w+)\s*,")
+CREATE_RE = re.compile(r"([\w.\[\]>-]+)\s*=\s*create(?:Button|Label)\(\s*[^,]+,\s*\"((?:[^\"\\]|\\.)*)\"")
+SET_TEXT_RE = re.compile(r"lv_label_set_text\(\s*([\w.\[\]>-]+)\s*,\s*\"((?:[^\"\\]|\\.)*)\"\s*\)")
+STYLE_FONT_RE = re.compile(r"(?:lv_style_set_text_font|initText)\(\s*&([\w.]+)\s*,\s*(?:[^,;]+,\s*)?&(\w+)\s*\)")
+ADD_STYLE_RE = re.compile(r"lv_obj_add_style\(\s*(.+?)\s*,\s*&([\w.]+)\s*,")
+CHILD_RE = re.compile(r"^lv_obj_get_child\(\s*(.+?)\s*,\s*0\s*\)$")
+BUILTIN_RE = re.compile(r"lv_font_montserrat_(\d+)")
+
+GLYPH_COMMENT_RE = re.compile(r"/\* U\+([0-9A-F]+) .*?\*/")
+DSC_RE = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                    r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}")
+COMPRESSION_RE = re.compile(r"^ \* Compression: (\w+)\n", re.M)
+CMAP_RE = re.compile(r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+                     r"\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), "
+                     r"\.type = (\w+)")
+
+
+def rle1_encode(data, bits):
+    """Run lengths of alternating clear and set bits, each as unsigned LEB128."""
+    runs, current, length = [], 0, 0
+    for i in range(bits):
+        bit = (data[i >> 3] >> (7 - (i & 7))) & 1
+        if bit == current:
+            length += 1
+        else:
+            runs.append(length)
+            current, length = bit, 1
+    runs.append(length)
+
+    out = bytearray()
+    for run in runs:
+        while True:
+            byte = run & 0x7f
+            run >>= 7
+            out.append(byte | (0x80 if run else 0))
+            if not run:
+                break
+    return bytes(out)
+
+
+def rle1_decode(data, bits):
+    out = bytearray((bits + 7) // 8)
+    pos, index, bit = 0, 0, 0
+    while pos < bits:
+        run, shift = 0, 0
+        while True:
+            byte = data[index]
+            index += 1
+            run |= (byte & 0x7f) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+        if bit:
+            for i in range(pos, min(pos + run, bits)):
+                out[i >> 3] |= 0x80 >> (i & 7)
+        pos += run
+        bit ^= 1
+    return bytes(out)
+
+
+def read(path):
+    with open(path, encoding="utf-8") as f:
+        return f.read()
+
+
+def unescape(text):
+    return bytes(text, "utf-8").decode("unicode_escape")
+
+
+def object_key(expr):
+    """Button labels are styled through lv_obj_get_child(btn, 0)."""
+    m = CHILD_RE.match(expr)
+    return m.group(1) if m else expr
+
+
+def scan_sources(patterns):
+    """Returns ({font: set(chars)}, set(built-in sizes referenced))."""
+    text = "\n".join(read(p) for pattern in patterns
+                     for p in sorted(glob.glob(os.path.join(ROOT, pattern))))
+    texts = {}
+    for m in CREATE_RE.finditer(text):
+        texts.setdefault(m.group(1), set()).update(unescape(m.group(2)))
+    for m in SET_TEXT_RE.finditer(text):
+        texts.setdefault(m.group(1), set()).update(unescape(m.group(2)))
+
+    used = {}
+    for m in FONT_STYLE_RE.finditer(text):
+        font = m.group(2)
+        used.setdefault(font, set()).update(texts.get(object_key(m.group(1)), ()))
+
+    # Shared styles: text properties inherit, so a button's style covers its label
+    style_fonts = {m.group(1): m.group(2) for m in STYLE_FONT_RE.finditer(text)}
+    for m in ADD_STYLE_RE.finditer(text):
+        font = style_fonts.get(m.group(2))
+        if font:
+            used.setdefault(font, set()).update(texts.get(object_key(m.group(1)), ()))
+
+    builtins = {int(size) for size in BUILTIN_RE.findall(text)}
+    return used, builtins
+
+
+class Font:
+    """The glyph tables of one lv_font_conv output file."""
+
+    def __init__(self, path):
+        self.path = path
+        self.text = read(path)
+
+        start = self.text.index("glyph_bitmap[] = {")
+        start = self.text.index("\n", start) + 1
+        end = self.text.index("};", start)
+        self.bitmap_span = (start, end)
+        blocks = GLYPH_COMMENT_RE.split(self.text[start:end])
+        # split() yields [before, cp, bytes, cp, bytes, ...]
+        self.bitmaps = [bytes(int(b, 16) for b in re.findall(r"0x[0-9a-fA-F]+", body))
+                        for body in blocks[2::2]]
+        self.comments = GLYPH_COMMENT_RE.findall(self.text[start:end])
+
+        start = self.text.index("glyph_dsc[] = {")
+        start = self.text.index("\n", start) + 1
+        end = self.text.index("};", start)
+        self.dsc_span = (start, end)
+        self.dsc = [tuple(int(v) for v in m.groups()) for m in DSC_RE.finditer(self.text[start:end])]
+
+        start = self.text.index(" *  CHARACTER MAPPING")
+        start = self.text.index("\n", self.text.index(" *--", start)) + 1
+        end = self.text.index("/*--------------------\n *  ALL CUSTOM DATA")
+        self.cmap_span = (start, end)
+        self.glyphs = self._map(self.text[start:end])
+
+        if "kern_dsc = NULL" not in self.text:
+            raise SystemExit(f"{path}: kerning tables are not supported")
+        if len(self.dsc) != len(self.bitmaps) + 1:
+            raise SystemExit(f"{path}: {len(self.bitmaps)} bitmaps but {len(self.dsc) - 1} glyph descriptors")
+
+        # bitmaps are kept decoded, stored_bytes is what the file holds
+        self.stored_bytes = sum(len(b) for b in self.bitmaps)
+        m = COMPRESSION_RE.search(self.text)
+        self.compression = m.group(1) if m else None
+        if self.compression == "rle1":
+            self.bitmaps = [rle1_decode(data, self.dsc[gid][2] * self.dsc[gid][3])
+                            for gid, data in enumerate(self.bitmaps, 1)]
+        elif self.compression:
+            raise SystemExit(f"{path}: compression {self.compression} is not supported")
+
+    def _map(self, cmap_text):
+        """Returns {codepoint: glyph id}."""
+        glyphs = {}
+        for m in CMAP_RE.finditer(cmap_text):
+            range_start, range_length, id_start = int(m.group(1)), int(m.group(2)), int(m.group(3))
+            kind = m.group(7)
+            if kind == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+                for i in range(range_length):
+                    glyphs[range_start + i] = id_start + i
+            elif kind == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+                offsets = self._array(cmap_text, m.group(4))
+                for i, ofs in enumerate(offsets):
+                    glyphs[range_start + ofs] = id_start + i
+            else:
+                raise SystemExit(f"{self.path}: cmap type {kind} is not supported")
+        return glyphs
+
+    @staticmethod
+    def _array(text, name):
+        m = re.search(name + r"\[\] = \{([^}]*)\}", text)
+        return [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", m.group(1))]
+
+    def size(self, glyph_count=None, bitmap_bytes=None, sparse=None):
+        """Flash used by the bitmap, descriptor and cmap tables."""
+        if glyph_count is None:
+            glyph_count = len(self.bitmaps)
+            bitmap_bytes = self.stored_bytes
+            sparse = "SPARSE_TINY" in self.text[self.cmap_span[0]:self.cmap_span[1]]
+        return bitmap_bytes + (glyph_count + 1) * GLYPH_DSC_BYTES + \
+            (glyph_count * UNICODE_LIST_ENTRY_BYTES if sparse else 0)
+
+    def subset(self, chars, compression=None):
+        """Returns the file text with only the glyphs of `chars`."""
+        if compression not in (None, "rle1"):
+            raise SystemExit(f"{self.path}: compression {compression} is not supported")
+        codepoints = sorted(cp for cp in {ord(c) for c in chars} if cp in self.glyphs)
+        if not codepoints:
+            raise SystemExit(f"{self.path}: none of the requested glyphs are in the font")
+
+        bitmap_lines, dsc_lines = [], []
+        dsc_lines.append("    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0}"
+                         " /* id = 0 reserved */")
+        index = 0
+        for cp in codepoints:
+            gid = self.glyphs[cp]
+            _, adv_w, box_w, box_h, ofs_x, ofs_y = self.dsc[gid]
+            data = self.bitmaps[gid - 1]
+            if compression == "rle1":
+                data = rle1_encode(data, box_w * box_h)
+            ch = chr(cp).replace("\\", "\\\\").replace('"', '\\"')
+            bitmap_lines.append(f'    /* U+{cp:04X} "{ch}" */')
+            for i in range(0, len(data), 8):
+                bitmap_lines.append("    " + " ".join(f"0x{b:x}," for b in data[i:i + 8]))
+            bitmap_lines.append("")
+            dsc_lines.append(f"    {{.bitmap_index = {index}, .adv_w = {adv_w}, .box_w = {box_w}, "
+                             f".box_h = {box_h}, .ofs_x = {ofs_x}, .ofs_y = {ofs_y}}}")
+            index += len(data)
+        bitmap = "\n".join(bitmap_lines).rstrip(",\n") + "\n"
+
+        first = codepoints[0]
+        offsets = [cp - first for cp in codepoints]
+        contiguous = offsets == list(range(len(offsets)))
+        if contiguous:
+            cmap = ("\n\n\n/*Collect the unicode lists and glyph_id offsets*/\n"
+                    "static const lv_font_fmt_txt_cmap_t cmaps[] =\n{\n    {\n"
+                    f"        .range_start = {first}, .range_length = {len(codepoints)}, .glyph_id_start = 1,\n"
+                    "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                    ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n    }\n};\n\n\n\n")
+        else:
+            values = ", ".join(f"0x{o:x}" for o in offsets)
+            cmap = ("\n\nstatic const uint16_t unicode_list_0[] = {\n"
+                    f"    {values}\n}};\n\n"
+                    "/*Collect the unicode lists and glyph_id offsets*/\n"
+                    "static const lv_font_fmt_txt_cmap_t cmaps[] =\n{\n    {\n"
+                    f"        .range_start = {first}, .range_length = {offsets[-1] + 1}, .glyph_id_start = 1,\n"
+                    f"        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = {len(offsets)}, "
+                    ".type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }\n};\n\n\n\n")
+
+        t = self.text
+        out = (t[:self.bitmap_span[0]] + bitmap + t[self.bitmap_span[1]:self.dsc_span[0]] +
+               ",\n".join(dsc_lines) + "\n" + t[self.dsc_span[1]:self.cmap_span[0]] + cmap +
+               t[self.cmap_span[1]:])
+        out = re.sub(r"\.cmap_num = \d+", ".cmap_num = 1", out)
+
+        listed = "".join(chr(cp) for cp in codepoints).replace("*/", "* /")
+        marker = f" * Subset: {listed}\n" + (f" * Compression: {compression}\n" if compression else "")
+        # Opts: names this tool; the lv_font_conv options of the full font move to Source:
+        out = re.sub(r" \* Opts: (.*)\n( \* Source: (.*)\n)?( \* Subset: .*\n)?( \* Compression: .*\n)?",
+                     lambda m: f" * Opts: {SUBSET_COMMAND}\n * Source: {m.group(3) or 'lv_font_conv ' + m.group(1)}\n"
+                     + marker, out, count=1)
+
+        prototype = "const uint8_t * glyphCacheGetBitmap(const lv_font_t * font, uint32_t letter);\n"
+        out = out.replace(prototype, "")
+        if compression:
+            out = out.replace("lv_font_get_bitmap_fmt_txt,", "glyphCacheGetBitmap,       ")
+            out = out.replace("\n\n/*-----------------\n *  PUBLIC FONT", "\n" + prototype + "\n/*-----------------\n *  PUBLIC FONT", 1)
+        else:
+            out = out.replace("glyphCacheGetBitmap,       ", "lv_font_get_bitmap_fmt_txt,")
+
+        new_size = self.size(len(codepoints), index, not contiguous)
+        return out, codepoints, new_size
+
+
+def builtin_sizes(conf_text):
+    return {int(m.group(1)): int(m.group(2))
+            for m in re.finditer(r"^#define LV_FONT_MONTSERRAT_(\d+) (\d)", conf_text, re.M)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    mode = parser.add_mutually_exclusive_group()
+    mode.add_argument("--write", action="store_true", help="rewrite the font files and lv_conf.h")
+    mode.add_argument("--check", action="store_true", help="fail if a font lacks a glyph the UI needs")
+    args = parser.parse_args()
+
+    manifest = json.loads(read(MANIFEST))
+    used, builtins = scan_sources(manifest["sources"])
+    conf = read(LV_CONF)
+    default = re.search(r"^#define LV_FONT_DEFAULT &lv_font_montserrat_(\d+)", conf, re.M)
+    if default:
+        builtins.add(int(default.group(1)))
+
+    missing = []
+    total_saved = 0
+    for name, entry in manifest["fonts"].items():
+        path = os.path.join(ROOT, entry["file"])
+        font = Font(path)
+        if name not in used:
+            print(f"{name}: not referenced, the linker drops it ({font.size()} bytes of tables)")
+            continue
+
+        chars = used[name] | set(entry.get("extra", ""))
+        absent = sorted(c for c in chars if ord(c) not in font.glyphs and not c.isspace())
+        if absent:
+            missing.append(f"{name}: no glyph for {''.join(absent)!r}")
+        if args.check:
+            continue
+
+        text, kept, new_size = font.subset(chars, entry.get("compress"))
+        old_size = font.size()
+        saved = old_size - new_size
+        total_saved += saved
+        print(f"{name}: {len(font.bitmaps)} -> {len(kept)} glyphs, {old_size} -> {new_size} bytes, "
+              f"saves {saved} ({''.join(chr(c) for c in kept)})")
+        if args.write and text != font.text:
+            with open(path, "w", encoding="utf-8") as f:
+                f.write(text)
+
+    enabled = builtin_sizes(conf)
+    unused = sorted(size for size, on in enabled.items() if on and size not in builtins)
+    if unused and not args.check:
+        print("built-in Montserrat sizes not referenced: " + ", ".join(map(str, unused)))
+        if args.write:
+            for size in unused:
+                conf = re.sub(rf"^#define LV_FONT_MONTSERRAT_{size} 1", f"#define LV_FONT_MONTSERRAT_{size} 0",
+                              conf, flags=re.M)
+            with open(LV_CONF, "w", encoding="utf-8") as f:
+                f.write(conf)
+    absent_builtins = sorted(size for size in builtins if not enabled.get(size))
+    for size in absent_builtins:
+        missing.append(f"lv_font_montserrat_{size} is referenced but not enabled in lv_conf.h")
+
+    if not args.check:
+        print(f"total saved: {total_saved} bytes")
+    for line in missing:
+        print(line, file=sys.stderr)
+    return 1 if missing else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
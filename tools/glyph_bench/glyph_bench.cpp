@@ -0,0 +1,183 @@
+/*
+ * Times redraws of the HVAC target temperature label with the sketch's
+ * montserrat_96, once reading uncompressed bitmaps the way LVGL's fmt_txt
+ * path does and once through the RLE1 glyph cache.
+ *
+ * Build and run from the repository root:
+ *
+ *   c++ -O2 -Wall -Itools/glyph_bench/include -I. -o glyph_bench \
+ *       tools/glyph_bench/glyph_bench.cpp glyph_cache.cpp -x c montserrat_96.c
+ *   ./glyph_bench
+ *
+ * Each redraw fetches the bitmap of every digit and expands it to 8 bit
+ * coverage, as LVGL's letter drawing does before blending. The host has
+ * no XIP flash cache, so the times only show the CPU side; the bytes read
+ * from flash per label show the other half.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#include "glyph_cache.h"
+#include "log_ring.h"
+
+extern "C" const lv_font_t montserrat_96;
+
+// Referenced by the font file, never called here
+extern "C" const lv_font_t lv_font_montserrat_48 = {};
+extern "C" bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *, void *, uint32_t, uint32_t) { return false; }
+extern "C" const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *, uint32_t) { return NULL; }
+
+// The cache logs through the ring on the device, straight to stderr here
+void logWrite(uint8_t, const char *tag, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "%s: ", tag);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+struct Glyph {
+    const lv_font_fmt_txt_glyph_dsc_t *dsc;
+    uint32_t storedBytes;               // RLE1 in the font file
+    std::vector<uint8_t> raw;           // what an uncompressed font would hold
+};
+
+static Glyph glyphs[128];
+static uint8_t coverage[128 * 128];
+
+static const lv_font_fmt_txt_glyph_dsc_t *findGlyph(uint32_t letter) {
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)montserrat_96.dsc;
+    const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[0];
+    for (uint16_t i = 0; i < cmap->list_length; i++) {
+        if (cmap->range_start + cmap->unicode_list[i] == letter) {
+            return &fdsc->glyph_dsc[cmap->glyph_id_start + i];
+        }
+    }
+    return NULL;
+}
+
+// Length of one RLE1 glyph: runs until the box is covered
+static uint32_t storedLength(const uint8_t *src, uint32_t bits) {
+    const uint8_t *p = src;
+    for (uint32_t pos = 0; pos < bits;) {
+        uint32_t run = 0;
+        uint8_t shift = 0;
+        do {
+            run |= (uint32_t)(*p & 0x7f) << shift;
+            shift += 7;
+        } while (*p++ & 0x80);
+        pos += run;
+    }
+    return p - src;
+}
+
+static uint32_t expand(const uint8_t *bitmap, const lv_font_fmt_txt_glyph_dsc_t *dsc) {
+    const uint32_t bits = (uint32_t)dsc->box_w * dsc->box_h;
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < bits; i++) {
+        coverage[i] = (bitmap[i >> 3] & (0x80 >> (i & 7))) ? 0xff : 0;
+        sum += coverage[i];
+    }
+    return sum;
+}
+
+static double nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+struct Result {
+    double nsPerLabel;
+    double flashBytesPerLabel;
+};
+
+static Result run(const std::vector<const char *> &labels, int rounds, bool cached, uint32_t *checksum) {
+    uint64_t flashBytes = 0;
+    const double start = nowNs();
+    for (int r = 0; r < rounds; r++) {
+        for (const char *label : labels) {
+            for (const char *c = label; *c; c++) {
+                Glyph &g = glyphs[(uint8_t)*c];
+                const uint8_t *bitmap;
+                if (cached) {
+                    const uint32_t misses = getGlyphCacheStats().misses;
+                    bitmap = glyphCacheGetBitmap(&montserrat_96, *c);
+                    if (getGlyphCacheStats().misses != misses) {
+                        flashBytes += g.storedBytes;
+                    }
+                } else {
+                    bitmap = g.raw.data();
+                    flashBytes += g.raw.size();
+                }
+                *checksum += expand(bitmap, g.dsc);
+            }
+        }
+    }
+    const double labels_drawn = (double)rounds * labels.size();
+    return {(nowNs() - start) / labels_drawn, flashBytes / labels_drawn};
+}
+
+int main() {
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)montserrat_96.dsc;
+    uint32_t rawTotal = 0, storedTotal = 0;
+    double decodeNs = 0;
+
+    // The first lookups are the cold misses, they also give the bitmaps an
+    // uncompressed font would hold
+    for (const char *c = "0123456789"; *c; c++) {
+        Glyph &g = glyphs[(uint8_t)*c];
+        g.dsc = findGlyph(*c);
+        if (!g.dsc) {
+            fprintf(stderr, "montserrat_96 has no '%c'\n", *c);
+            return 1;
+        }
+        const uint32_t bits = (uint32_t)g.dsc->box_w * g.dsc->box_h;
+        const double start = nowNs();
+        const uint8_t *decoded = glyphCacheGetBitmap(&montserrat_96, *c);
+        decodeNs += nowNs() - start;
+        g.raw.assign(decoded, decoded + (bits + 7) / 8);
+        g.storedBytes = storedLength(&fdsc->glyph_bitmap[g.dsc->bitmap_index], bits);
+        rawTotal += g.raw.size();
+        storedTotal += g.storedBytes;
+    }
+    printf("digits: %u bytes uncompressed, %u bytes RLE1, %.0f ns per cold decode\n", rawTotal, storedTotal,
+           decodeNs / 10);
+
+    // Tapping + and - between two values, then sweeping the whole range
+    const std::vector<const char *> toggle = {"22", "23", "22", "23", "22", "21"};
+    std::vector<const char *> sweep;
+    static char sweepText[12][3];
+    for (int t = 16; t <= 27; t++) {
+        snprintf(sweepText[t - 16], sizeof(sweepText[0]), "%d", t);
+        sweep.push_back(sweepText[t - 16]);
+    }
+
+    const int rounds = 20000;
+    uint32_t checksum = 0;
+    struct Case {
+        const char *name;
+        const std::vector<const char *> &labels;
+    } cases[] = {{"toggle 22/23", toggle}, {"sweep 16..27", sweep}};
+
+    printf("%-14s %-12s %10s %14s\n", "labels", "bitmaps", "ns/label", "flash B/label");
+    for (const Case &c : cases) {
+        const Result raw = run(c.labels, rounds, false, &checksum);
+        const GlyphCacheStats before = getGlyphCacheStats();
+        const Result cached = run(c.labels, rounds, true, &checksum);
+        const GlyphCacheStats after = getGlyphCacheStats();
+        printf("%-14s %-12s %10.0f %14.1f\n", c.name, "raw", raw.nsPerLabel, raw.flashBytesPerLabel);
+        printf("%-14s %-12s %10.0f %14.1f  (%u hits, %u misses)\n", c.name, "rle1 cache", cached.nsPerLabel,
+               cached.flashBytesPerLabel, after.hits - before.hits, after.misses - before.misses);
+    }
+
+    const GlyphCacheStats stats = getGlyphCacheStats();
+    printf("cache: %d entries, %u bytes of RAM, %u evictions (checksum %u)\n", GLYPH_CACHE_ENTRIES, stats.bytes,
+           stats.evictions, checksum);
+    return 0;
+}
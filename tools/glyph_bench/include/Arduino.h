@@ -0,0 +1,4 @@
+/*
+ * Host stand-in for the Arduino core; the glyph cache uses nothing from it
+ */
+#pragma once
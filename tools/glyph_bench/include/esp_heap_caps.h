@@ -0,0 +1,14 @@
+/*
+ * Host stand-in for the ESP-IDF header of the same name, every region is
+ * plain malloc
+ */
+#pragma once
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+
+static inline void *heap_caps_malloc(size_t size, unsigned caps) { (void)caps; return malloc(size); }
+static inline void heap_caps_free(void *ptr) { free(ptr); }
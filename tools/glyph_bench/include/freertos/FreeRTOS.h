@@ -0,0 +1,11 @@
+/*
+ * Host stand-in for the FreeRTOS header of the same name, the bench is
+ * single threaded so the spinlock does nothing
+ */
+#pragma once
+
+typedef int portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux)  ((void)(mux))
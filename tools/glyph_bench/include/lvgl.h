@@ -0,0 +1,84 @@
+/*
+ * Host stand-in for the parts of LVGL 8 that fmt_txt fonts and the glyph
+ * cache use
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LVGL_VERSION_MAJOR 8
+#define LVGL_VERSION_MINOR 3
+#define LV_VERSION_CHECK(x, y, z) (x == LVGL_VERSION_MAJOR && (y < LVGL_VERSION_MINOR || (y == LVGL_VERSION_MINOR && z <= 0)))
+#define LV_ATTRIBUTE_LARGE_CONST
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t bitmap_index : 20;
+    uint32_t adv_w : 12;
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+} lv_font_fmt_txt_glyph_dsc_t;
+
+typedef enum {
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_FULL,
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_TINY,
+} lv_font_fmt_txt_cmap_type_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    const uint16_t *unicode_list;
+    const void *glyph_id_ofs_list;
+    uint16_t list_length;
+    lv_font_fmt_txt_cmap_type_t type;
+} lv_font_fmt_txt_cmap_t;
+
+typedef struct {
+    uint32_t last_letter;
+    uint32_t last_glyph_id;
+} lv_font_fmt_txt_glyph_cache_t;
+
+typedef struct {
+    const uint8_t *glyph_bitmap;
+    const lv_font_fmt_txt_glyph_dsc_t *glyph_dsc;
+    const lv_font_fmt_txt_cmap_t *cmaps;
+    const void *kern_dsc;
+    uint16_t kern_scale;
+    uint16_t cmap_num : 9;
+    uint16_t bpp : 4;
+    uint16_t kern_classes : 1;
+    uint16_t bitmap_format : 2;
+    lv_font_fmt_txt_glyph_cache_t *cache;
+} lv_font_fmt_txt_dsc_t;
+
+enum { LV_FONT_SUBPX_NONE };
+
+typedef struct _lv_font_t {
+    bool (*get_glyph_dsc)(const struct _lv_font_t *, void *, uint32_t, uint32_t);
+    const uint8_t *(*get_glyph_bitmap)(const struct _lv_font_t *, uint32_t);
+    int16_t line_height;
+    int16_t base_line;
+    uint8_t subpx;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    const void *dsc;
+    const struct _lv_font_t *fallback;
+    void *user_data;
+} lv_font_t;
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, void *dsc_out, uint32_t letter, uint32_t letter_next);
+const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t letter);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,160 @@
+/*
+ * Times parseLightState() and parseHvacState() on Home Assistant state
+ * payloads and checks what they extract. The payloads are synthetic: they
+ * follow the shape of light and climate state documents, attribute lists
+ * included, and add edge cases such as escaped quotes and braces inside
+ * strings. None was captured from a live instance.
+ *
+ * Build and run from the repository root:
+ *
+ *   c++ -O2 -Wall -I. -o ha_state_bench tools/ha_state_bench/ha_state_bench.cpp ha_state.cpp
+ *   ./ha_state_bench [payload directory]
+ *
+ * For comparison the last column estimates the StaticJsonDocument
+ * capacity ArduinoJson 6 needs to deserialize the whole payload on the
+ * ESP32: 16 bytes per value plus a copy of every string.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+
+#include "ha_state.h"
+
+struct Payload {
+    const char *file;
+    bool hvac;
+    const char *expected;       // extracted fields, as printed below
+};
+
+static const Payload PAYLOADS[] = {
+    {"light_on.json", false, "state=ON brightness=178 color_temp=370"},
+    {"light_off.json", false, "state=OFF brightness=- color_temp=-"},
+    {"climate_cool.json", true, "hvac_mode=cool temperature=22.0 current_temperature=24.5"},
+    {"climate_off.json", true, "hvac_mode=off temperature=- current_temperature=25.1"},
+};
+
+static bool readFile(const std::string &path, std::string *out) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    char chunk[512];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        out->append(chunk, n);
+    }
+    fclose(f);
+    // The recorded files end with a newline the broker would not send
+    while (!out->empty() && (out->back() == '\n' || out->back() == '\r')) {
+        out->pop_back();
+    }
+    return true;
+}
+
+static size_t arduinoJsonCapacity(const std::string &json) {
+    size_t values = 0, keys = 0, stringBytes = 0;
+    for (size_t i = 0; i < json.size(); i++) {
+        const char c = json[i];
+        if (c == '"') {
+            size_t length = 0;
+            for (i++; i < json.size() && json[i] != '"'; i++, length++) {
+                if (json[i] == '\\') {
+                    i++;
+                }
+            }
+            values++;
+            stringBytes += length + 1;
+        } else if (c == ':') {
+            keys++;
+        } else if (c == '{' || c == '[' || c == 't' || c == 'f' || c == 'n') {
+            values++;
+        } else if ((c == '-' || (c >= '0' && c <= '9')) && (i == 0 || strchr(":,[ ", json[i - 1]))) {
+            values++;
+        }
+    }
+    // Keys are strings but share their member's slot; the root has none
+    return (values - keys - 1) * 16 + stringBytes;
+}
+
+static std::string describe(const Payload &p, const std::string &json, bool *ok) {
+    char text[128];
+    if (p.hvac) {
+        HvacStateFields f;
+        *ok = parseHvacState(json.data(), json.size(), &f);
+        char target[16] = "-", current[16] = "-";
+        if (f.hasTargetTemp) snprintf(target, sizeof(target), "%.1f", f.targetTemp);
+        if (f.hasCurrentTemp) snprintf(current, sizeof(current), "%.1f", f.currentTemp);
+        snprintf(text, sizeof(text), "hvac_mode=%s temperature=%s current_temperature=%s",
+                 f.hasMode ? f.mode : "-", target, current);
+    } else {
+        LightStateFields f;
+        *ok = parseLightState(json.data(), json.size(), &f);
+        char brightness[16] = "-", mireds[16] = "-";
+        if (f.hasBrightness) snprintf(brightness, sizeof(brightness), "%d", f.brightness);
+        if (f.hasColorTemp) snprintf(mireds, sizeof(mireds), "%d", f.colorTempMireds);
+        snprintf(text, sizeof(text), "state=%s brightness=%s color_temp=%s",
+                 f.hasState ? (f.on ? "ON" : "OFF") : "-", brightness, mireds);
+    }
+    return text;
+}
+
+static double nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    const std::string dir = argc > 1 ? argv[1] : "tools/ha_state_bench/payloads";
+    bool allOk = true;
+
+    printf("%-18s %6s %9s %8s %14s\n", "payload", "bytes", "ns/parse", "MB/s", "ArduinoJson B");
+    for (const Payload &p : PAYLOADS) {
+        std::string json;
+        if (!readFile(dir + "/" + p.file, &json)) {
+            fprintf(stderr, "cannot read %s/%s\n", dir.c_str(), p.file);
+            return 1;
+        }
+
+        bool ok;
+        const std::string got = describe(p, json, &ok);
+        if (!ok || got != p.expected) {
+            fprintf(stderr, "%s: got \"%s\"%s, expected \"%s\"\n", p.file, got.c_str(), ok ? "" : " (parse error)",
+                    p.expected);
+            allOk = false;
+        }
+
+        const int rounds = 200000;
+        volatile int sink = 0;
+        const double start = nowNs();
+        for (int r = 0; r < rounds; r++) {
+            if (p.hvac) {
+                HvacStateFields f;
+                sink += parseHvacState(json.data(), json.size(), &f);
+            } else {
+                LightStateFields f;
+                sink += parseLightState(json.data(), json.size(), &f);
+            }
+        }
+        const double ns = (nowNs() - start) / rounds;
+        printf("%-18s %6zu %9.0f %8.0f %14zu\n", p.file, json.size(), ns, json.size() / ns * 1e3,
+               arduinoJsonCapacity(json));
+    }
+
+    // Truncated and malformed input must fail, not read past the end
+    const std::string broken[] = {"", "{", "{\"state\":\"ON\"", "{\"state\" \"ON\"}", "[1,2]",
+                                  "{\"a\":[1,{\"b\":\"]\"}],\"state\":}", "{\"state\":\"ON\"} x"};
+    for (const std::string &json : broken) {
+        LightStateFields f;
+        if (parseLightState(json.data(), json.size(), &f)) {
+            fprintf(stderr, "accepted malformed payload: %s\n", json.c_str());
+            allOk = false;
+        }
+    }
+
+    printf("fields per parse: %zu bytes (light), %zu bytes (hvac)\n", sizeof(LightStateFields),
+           sizeof(HvacStateFields));
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""Publish a retained Home Assistant climate state of a chosen size.
+
+Checks the panel's large-payload receive path against a local broker. The
+recorded climate payload from tools/ha_state_bench is padded with an extra
+attribute to the requested size, then published retained to the HVAC
+state topic in config.h with mosquitto_pub. The panel should show the
+payload's hvac_mode and temperature. Its diagnostics (mqtt_max_payload,
+mqtt_dropped) show what arrived.
+
+Usage, from the sketch folder:
+  tools/mqtt_large_state.py --size 6000
+  tools/mqtt_large_state.py --size 12000 --host 192.168.1.50   # expect a drop
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+PAYLOAD = os.path.join(ROOT, "tools", "ha_state_bench", "payloads", "climate_cool.json")
+
+
+def config_value(name):
+    with open(os.path.join(ROOT, "config.h"), encoding="utf-8") as f:
+        m = re.search(r'#define %s "([^"]*)"' % name, f.read())
+    return m.group(1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--size", type=int, default=6000, help="payload bytes")
+    parser.add_argument("--host", default="localhost")
+    parser.add_argument("--port", type=int, default=1883)
+    parser.add_argument("--temperature", type=float, default=23)
+    args = parser.parse_args()
+
+    with open(PAYLOAD, encoding="utf-8") as f:
+        state = json.load(f)
+    state["temperature"] = args.temperature
+    state["padding"] = ""
+    text = json.dumps(state, ensure_ascii=False, separators=(",", ":"))
+    state["padding"] = "x" * max(0, args.size - len(text.encode("utf-8")))
+    text = json.dumps(state, ensure_ascii=False, separators=(",", ":"))
+
+    topic = "homeassistant/climate/%s/state" % config_value("HVAC_ENTITY_ID")
+    subprocess.run(["mosquitto_pub", "-h", args.host, "-p", str(args.port), "-r", "-t", topic, "-s"],
+                   input=text.encode("utf-8"), check=True)
+    print("published %d bytes retained to %s" % (len(text.encode("utf-8")), topic))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,106 @@
+/*
+ * Host implementations of the few ESP-IDF functions esp_lcd_sh8601.c and
+ * the panel simulator need: the esp_lcd dispatch wrappers, GPIO no-ops
+ * and a simulated clock for vTaskDelay.
+ */
+#include "esp_lcd_panel_io_interface.h"
+#include "esp_lcd_panel_interface.h"
+#include "driver/gpio.h"
+#include "freertos/task.h"
+#include "panel_sim.h"
+
+static uint64_t sim_delay_ms;
+
+void vTaskDelay(TickType_t ticks)
+{
+    sim_delay_ms += ticks;
+}
+
+uint64_t panel_sim_delay_ms(void)
+{
+    return sim_delay_ms;
+}
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    (void)config;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    (void)gpio_num;
+    (void)level;
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
+{
+    (void)gpio_num;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_rx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, void *param, size_t param_size)
+{
+    return io->rx_param ? io->rx_param(io, lcd_cmd, param, param_size) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size)
+{
+    return io->tx_param(io, lcd_cmd, param, param_size);
+}
+
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *color, size_t color_size)
+{
+    return io->tx_color(io, lcd_cmd, color, color_size);
+}
+
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io)
+{
+    return io->del(io);
+}
+
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel)
+{
+    return panel->reset(panel);
+}
+
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel)
+{
+    return panel->init(panel);
+}
+
+esp_err_t esp_lcd_panel_del(esp_lcd_panel_handle_t panel)
+{
+    return panel->del(panel);
+}
+
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end, const void *color_data)
+{
+    return panel->draw_bitmap(panel, x_start, y_start, x_end, y_end, color_data);
+}
+
+esp_err_t esp_lcd_panel_mirror(esp_lcd_panel_handle_t panel, bool mirror_x, bool mirror_y)
+{
+    return panel->mirror ? panel->mirror(panel, mirror_x, mirror_y) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_swap_xy(esp_lcd_panel_handle_t panel, bool swap_axes)
+{
+    return panel->swap_xy ? panel->swap_xy(panel, swap_axes) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_set_gap(esp_lcd_panel_handle_t panel, int x_gap, int y_gap)
+{
+    return panel->set_gap ? panel->set_gap(panel, x_gap, y_gap) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_invert_color(esp_lcd_panel_handle_t panel, bool invert_color_data)
+{
+    return panel->invert_color ? panel->invert_color(panel, invert_color_data) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on_off)
+{
+    return panel->disp_on_off ? panel->disp_on_off(panel, on_off) : ESP_ERR_NOT_SUPPORTED;
+}
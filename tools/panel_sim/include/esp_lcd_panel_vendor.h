@@ -0,0 +1,23 @@
+/*
+ * Host stand-in for the ESP-IDF header of the same name
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+
+typedef enum {
+    LCD_RGB_ELEMENT_ORDER_RGB = 0,
+    LCD_RGB_ELEMENT_ORDER_BGR,
+} lcd_rgb_element_order_t;
+
+typedef struct {
+    int reset_gpio_num;
+    lcd_rgb_element_order_t rgb_ele_order;
+    uint32_t bits_per_pixel;
+    struct {
+        unsigned int reset_active_high: 1;
+    } flags;
+    void *vendor_config;
+} esp_lcd_panel_dev_config_t;
@@ -0,0 +1,12 @@
+/*
+ * Host stand-in for the ESP-IDF header of the same name. Errors and
+ * warnings go to stderr, everything else is dropped.
+ */
+#pragma once
+
+#include <stdio.h>
+
+#define ESP_LOGE(tag, fmt, ...) fprintf(stderr, "E %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) fprintf(stderr, "W %s: " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) do { (void)(tag); } while (0)
+#define ESP_LOGD(tag, fmt, ...) do { (void)(tag); } while (0)
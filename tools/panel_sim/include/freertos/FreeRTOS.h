@@ -0,0 +1,14 @@
+/*
+ * Host stand-in for the FreeRTOS header of the same name
+ */
+#pragma once
+
+#include <assert.h>   // FreeRTOSConfig.h pulls this in on the target
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+
+#define pdTRUE              1
+#define pdFALSE             0
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
@@ -0,0 +1,9 @@
+/*
+ * Host stand-in for the FreeRTOS header of the same name. Delays do not
+ * sleep; they are added to the simulated time (see esp_idf_shim.c).
+ */
+#pragma once
+
+#include "FreeRTOS.h"
+
+void vTaskDelay(TickType_t ticks);
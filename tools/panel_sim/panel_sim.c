@@ -0,0 +1,401 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_lcd_panel_io_interface.h"
+#include "esp_lcd_panel_commands.h"
+#include "panel_sim.h"
+
+#define OPCODE_WRITE_CMD    0x02
+#define OPCODE_READ_CMD     0x03
+#define OPCODE_WRITE_COLOR  0x32
+
+typedef struct {
+    esp_lcd_panel_io_t base;
+    panel_sim_config_t config;
+    panel_sim_stats_t stats;
+    uint8_t *frame;             // RGB888, as shown
+    uint32_t rng;
+
+    // controller state
+    bool sleeping;
+    bool display_on;
+    uint8_t madctl;
+    uint8_t colmod;
+    uint8_t brightness;
+    int x0, x1, y0, y1;         // window, inclusive
+    int cx, cy;                 // write cursor
+    bool window_full;           // cursor went past the last pixel of the window
+    uint8_t carry[3];           // bytes of a pixel split across transactions
+    size_t carry_len;
+} panel_sim_t;
+
+static uint32_t next_random(panel_sim_t *sim)
+{
+    // xorshift32, so runs with the same seed inject the same errors
+    uint32_t x = sim->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sim->rng = x;
+    return x;
+}
+
+static bool should_corrupt(panel_sim_t *sim)
+{
+    if (!sim->config.fail_above_hz || sim->config.pclk_hz <= sim->config.fail_above_hz) {
+        return false;
+    }
+    if (next_random(sim) % 1000 >= sim->config.error_permille) {
+        return false;
+    }
+    sim->stats.errors_injected++;
+    return true;
+}
+
+static void flip_random_bit(panel_sim_t *sim, uint8_t *data, size_t len)
+{
+    if (len) {
+        const uint32_t bit = next_random(sim) % (len * 8);
+        data[bit / 8] ^= 1 << (bit % 8);
+    }
+}
+
+static void account(panel_sim_t *sim, uint64_t clocks)
+{
+    sim->stats.wire_ns += clocks * 1000000000ULL / sim->config.pclk_hz + sim->config.trans_overhead_ns;
+}
+
+static int bytes_per_pixel(const panel_sim_t *sim)
+{
+    return (sim->colmod & 0x07) == 0x05 ? 2 : 3;
+}
+
+static uint16_t be16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static void put_pixel(panel_sim_t *sim, const uint8_t *px)
+{
+    uint8_t rgb[3];
+
+    if (sim->window_full) {
+        // more data than the window holds, the controller starts over at its origin
+        sim->stats.window_wraps++;
+        sim->window_full = false;
+    }
+
+    if (bytes_per_pixel(sim) == 2) {
+        // the panel takes RGB565 high byte first
+        const uint16_t v = be16(px);
+        const uint8_t r = (v >> 11) & 0x1F, g = (v >> 5) & 0x3F, b = v & 0x1F;
+        rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+        rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+        rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+    } else if ((sim->colmod & 0x07) == 0x06) {
+        // RGB666 uses the 6 high bits of each byte
+        for (int i = 0; i < 3; i++) {
+            rgb[i] = (uint8_t)((px[i] & 0xFC) | (px[i] >> 6));
+        }
+    } else {
+        memcpy(rgb, px, 3);
+    }
+
+    // mirroring relative to the upright MADCTL value
+    const uint8_t diff = sim->madctl ^ sim->config.ref_madctl;
+    const int x = (diff & LCD_CMD_MX_BIT) ? sim->config.width - 1 - sim->cx : sim->cx;
+    const int y = (diff & LCD_CMD_MY_BIT) ? sim->config.height - 1 - sim->cy : sim->cy;
+    if (x >= 0 && x < sim->config.width && y >= 0 && y < sim->config.height) {
+        memcpy(sim->frame + ((size_t)y * sim->config.width + x) * 3, rgb, 3);
+    }
+    sim->stats.pixels_written++;
+
+    if (++sim->cx > sim->x1) {
+        sim->cx = sim->x0;
+        if (++sim->cy > sim->y1) {
+            sim->cy = sim->y0;
+            sim->window_full = true;
+        }
+    }
+}
+
+static void write_pixels(panel_sim_t *sim, const uint8_t *data, size_t len)
+{
+    const size_t bpp = bytes_per_pixel(sim);
+
+    while (len) {
+        const size_t take = bpp - sim->carry_len < len ? bpp - sim->carry_len : len;
+        memcpy(sim->carry + sim->carry_len, data, take);
+        sim->carry_len += take;
+        data += take;
+        len -= take;
+        if (sim->carry_len == bpp) {
+            put_pixel(sim, sim->carry);
+            sim->carry_len = 0;
+        }
+    }
+}
+
+static int range_start(const uint8_t *p)
+{
+    return be16(p);
+}
+
+static int range_end(const uint8_t *p)
+{
+    return be16(p + 2);
+}
+
+static void apply_command(panel_sim_t *sim, uint8_t cmd, const uint8_t *p, size_t n)
+{
+    switch (cmd) {
+    case LCD_CMD_SWRESET:
+        sim->sleeping = true;
+        sim->display_on = false;
+        break;
+    case LCD_CMD_SLPIN:
+        sim->sleeping = true;
+        break;
+    case LCD_CMD_SLPOUT:
+        sim->sleeping = false;
+        break;
+    case LCD_CMD_DISPON:
+        sim->display_on = true;
+        break;
+    case LCD_CMD_DISPOFF:
+        sim->display_on = false;
+        break;
+    case LCD_CMD_CASET:
+        if (n >= 4) {
+            sim->x0 = range_start(p);
+            sim->x1 = range_end(p);
+        }
+        break;
+    case LCD_CMD_RASET:
+        if (n >= 4) {
+            sim->y0 = range_start(p);
+            sim->y1 = range_end(p);
+            sim->stats.windows++;
+        }
+        break;
+    case LCD_CMD_MADCTL:
+        if (n >= 1) {
+            sim->madctl = p[0];
+        }
+        break;
+    case LCD_CMD_COLMOD:
+        if (n >= 1) {
+            sim->colmod = p[0];
+        }
+        break;
+    case LCD_CMD_WRDISBV:
+        if (n >= 1) {
+            sim->brightness = p[0];
+        }
+        break;
+    case LCD_CMD_NOP:
+    case LCD_CMD_INVOFF:
+    case LCD_CMD_INVON:
+    case LCD_CMD_PTLON:
+    case LCD_CMD_NORON:
+    case LCD_CMD_PTLAR:
+    case LCD_CMD_IDMON:
+    case LCD_CMD_IDMOFF:
+    case LCD_CMD_VSCRDEF:
+    case LCD_CMD_VSCSAD:
+    case LCD_CMD_TEON:
+    case LCD_CMD_TEOFF:
+    case LCD_CMD_STE:
+        break;
+    default:
+        sim->stats.unknown_cmds++;
+        break;
+    }
+}
+
+static esp_err_t sim_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
+{
+    panel_sim_t *sim = (panel_sim_t *)io;
+    const uint8_t opcode = (uint32_t)lcd_cmd >> 24;
+    const uint8_t cmd = (lcd_cmd >> 8) & 0xFF;
+
+    sim->stats.cmd_transactions++;
+    sim->stats.param_bytes += param_size;
+    account(sim, 32 + 8ULL * param_size);
+
+    if (opcode != OPCODE_WRITE_CMD) {
+        fprintf(stderr, "panel_sim: tx_param with opcode 0x%02X, expected 0x02\n", opcode);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t p[16] = {0};
+    const size_t n = param_size < sizeof(p) ? param_size : sizeof(p);
+    if (param) {
+        memcpy(p, param, n);
+    }
+    if (should_corrupt(sim)) {
+        flip_random_bit(sim, p, n);
+    }
+    apply_command(sim, cmd, p, n);
+    return ESP_OK;
+}
+
+static esp_err_t sim_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size)
+{
+    panel_sim_t *sim = (panel_sim_t *)io;
+    const uint8_t opcode = (uint32_t)lcd_cmd >> 24;
+    const uint8_t cmd = (lcd_cmd >> 8) & 0xFF;
+    uint8_t *out = (uint8_t *)param;
+
+    sim->stats.read_transactions++;
+    account(sim, 32 + 8ULL * param_size);
+
+    if (opcode != OPCODE_READ_CMD) {
+        fprintf(stderr, "panel_sim: rx_param with opcode 0x%02X, expected 0x03\n", opcode);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(out, 0, param_size);
+    switch (cmd) {
+    case LCD_CMD_RDDID:
+        memcpy(out, sim->config.id, param_size < 3 ? param_size : 3);
+        break;
+    case LCD_CMD_RDDPM:
+        out[0] = (uint8_t)(0x80 | (!sim->sleeping << 4) | (sim->display_on << 2));
+        break;
+    case LCD_CMD_RDD_MADCTL:
+        out[0] = sim->madctl;
+        break;
+    case LCD_CMD_RDD_COLMOD:
+        out[0] = sim->colmod;
+        break;
+    case LCD_CMD_RDDISBV:
+        out[0] = sim->brightness;
+        break;
+    default:
+        sim->stats.unknown_cmds++;
+        break;
+    }
+    if (should_corrupt(sim)) {
+        flip_random_bit(sim, out, param_size);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t sim_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size)
+{
+    panel_sim_t *sim = (panel_sim_t *)io;
+    const uint8_t opcode = (uint32_t)lcd_cmd >> 24;
+    const uint8_t cmd = (lcd_cmd >> 8) & 0xFF;
+
+    sim->stats.color_transactions++;
+    sim->stats.color_bytes += color_size;
+    account(sim, 32 + 2ULL * color_size);
+
+    if (opcode != OPCODE_WRITE_COLOR) {
+        fprintf(stderr, "panel_sim: tx_color with opcode 0x%02X, expected 0x32\n", opcode);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (cmd == LCD_CMD_RAMWR) {
+        sim->cx = sim->x0;
+        sim->cy = sim->y0;
+        sim->window_full = false;
+        sim->carry_len = 0;
+        if ((sim->madctl ^ sim->config.ref_madctl) & LCD_CMD_MV_BIT) {
+            // swapped axes are not modelled, pixels land as if MV matched
+            sim->stats.unsupported++;
+        }
+    } else if (cmd != LCD_CMD_WRMEMC) {
+        fprintf(stderr, "panel_sim: pixel data for command 0x%02X\n", cmd);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (should_corrupt(sim)) {
+        uint8_t *copy = malloc(color_size);
+        if (!copy) {
+            return ESP_ERR_NO_MEM;
+        }
+        memcpy(copy, color, color_size);
+        flip_random_bit(sim, copy, color_size);
+        write_pixels(sim, copy, color_size);
+        free(copy);
+    } else {
+        write_pixels(sim, color, color_size);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t sim_del(esp_lcd_panel_io_t *io)
+{
+    panel_sim_t *sim = (panel_sim_t *)io;
+    free(sim->frame);
+    free(sim);
+    return ESP_OK;
+}
+
+esp_err_t panel_sim_new_io(const panel_sim_config_t *config, esp_lcd_panel_io_handle_t *ret_io)
+{
+    panel_sim_t *sim = calloc(1, sizeof(panel_sim_t));
+    if (!sim) {
+        return ESP_ERR_NO_MEM;
+    }
+    sim->frame = calloc((size_t)config->width * config->height, 3);
+    if (!sim->frame) {
+        free(sim);
+        return ESP_ERR_NO_MEM;
+    }
+
+    sim->config = *config;
+    sim->rng = config->seed ? config->seed : 1;
+    sim->sleeping = true;
+    sim->colmod = 0x77;
+    sim->x1 = config->width - 1;
+    sim->y1 = config->height - 1;
+
+    sim->base.rx_param = sim_rx_param;
+    sim->base.tx_param = sim_tx_param;
+    sim->base.tx_color = sim_tx_color;
+    sim->base.del = sim_del;
+    *ret_io = &sim->base;
+    return ESP_OK;
+}
+
+void panel_sim_set_pclk(esp_lcd_panel_io_handle_t io, uint32_t pclk_hz)
+{
+    ((panel_sim_t *)io)->config.pclk_hz = pclk_hz;
+}
+
+void panel_sim_get_stats(esp_lcd_panel_io_handle_t io, panel_sim_stats_t *stats)
+{
+    *stats = ((panel_sim_t *)io)->stats;
+}
+
+void panel_sim_reset_stats(esp_lcd_panel_io_handle_t io)
+{
+    memset(&((panel_sim_t *)io)->stats, 0, sizeof(panel_sim_stats_t));
+}
+
+bool panel_sim_get_pixel(esp_lcd_panel_io_handle_t io, int x, int y, uint8_t rgb[3])
+{
+    const panel_sim_t *sim = (const panel_sim_t *)io;
+    if (x < 0 || x >= sim->config.width || y < 0 || y >= sim->config.height) {
+        return false;
+    }
+    memcpy(rgb, sim->frame + ((size_t)y * sim->config.width + x) * 3, 3);
+    return true;
+}
+
+int panel_sim_dump_ppm(esp_lcd_panel_io_handle_t io, const char *path)
+{
+    const panel_sim_t *sim = (const panel_sim_t *)io;
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return -1;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", sim->config.width, sim->config.height);
+    const size_t bytes = (size_t)sim->config.width * sim->config.height * 3;
+    const int ok = fwrite(sim->frame, 1, bytes, f) == bytes;
+    return (fclose(f) == 0 && ok) ? 0 : -1;
+}
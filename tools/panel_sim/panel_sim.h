@@ -0,0 +1,93 @@
+/*
+ * Host-side simulation of the SH8601 behind an esp_lcd panel IO
+ *
+ * panel_sim_new_io() returns an esp_lcd_panel_io_handle_t that can be handed
+ * to esp_lcd_new_panel_sh8601() in place of the QSPI panel IO. It decodes the
+ * 32-bit QSPI framing (opcode 0x02 command, 0x03 read, 0x32 pixel data, with
+ * the command byte in bits 15..8), keeps the controller state that matters
+ * for drawing and writes pixels into an in-memory frame.
+ *
+ * Wire time model, per transaction:
+ *   command/read  32 + 8 * n clocks   (header and parameters on one line)
+ *   pixel data    32 + 2 * n clocks   (header on one line, data on four)
+ *   plus trans_overhead_ns for chip select and driver setup.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    int width;                  // frame memory size
+    int height;
+    uint32_t pclk_hz;
+    uint32_t trans_overhead_ns; // fixed cost of every transaction
+    uint8_t ref_madctl;         // MADCTL value that shows the frame upright
+    uint8_t id[3];              // answer to RDDID
+    uint32_t fail_above_hz;     // corrupt transfers above this clock, 0 never
+    uint32_t error_permille;    // chance per transaction once above the threshold
+    uint32_t seed;
+} panel_sim_config_t;
+
+// 536x240 with the MADCTL the board's init table uses
+#define PANEL_SIM_DEFAULT_CONFIG()      \
+    {                                   \
+        .width = 536,                   \
+        .height = 240,                  \
+        .pclk_hz = 40 * 1000 * 1000,    \
+        .trans_overhead_ns = 2000,      \
+        .ref_madctl = 0xF0,             \
+        .id = {0x00, 0x80, 0x00},       \
+        .fail_above_hz = 0,             \
+        .error_permille = 0,            \
+        .seed = 1,                      \
+    }
+
+typedef struct {
+    uint32_t cmd_transactions;
+    uint32_t read_transactions;
+    uint32_t color_transactions;
+    uint64_t param_bytes;
+    uint64_t color_bytes;
+    uint64_t wire_ns;           // estimated bus time of everything above
+    uint64_t pixels_written;
+    uint32_t windows;           // CASET/RASET pairs
+    uint32_t window_wraps;      // pixel data ran past the end of the window
+    uint32_t unknown_cmds;      // accepted, but not modelled
+    uint32_t unsupported;       // modelled commands the simulation cannot apply (MADCTL MV)
+    uint32_t errors_injected;
+} panel_sim_stats_t;
+
+/**
+ * @brief Create a simulated panel IO
+ *
+ * @param[in]  config Simulation settings, see PANEL_SIM_DEFAULT_CONFIG()
+ * @param[out] ret_io Returned panel IO handle, released with esp_lcd_panel_io_del()
+ * @return
+ *      - ESP_OK: Success
+ *      - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t panel_sim_new_io(const panel_sim_config_t *config, esp_lcd_panel_io_handle_t *ret_io);
+
+void panel_sim_set_pclk(esp_lcd_panel_io_handle_t io, uint32_t pclk_hz);
+void panel_sim_get_stats(esp_lcd_panel_io_handle_t io, panel_sim_stats_t *stats);
+void panel_sim_reset_stats(esp_lcd_panel_io_handle_t io);
+
+// Pixel of the frame as shown, RGB888. Returns false outside the frame.
+bool panel_sim_get_pixel(esp_lcd_panel_io_handle_t io, int x, int y, uint8_t rgb[3]);
+
+// Writes the frame as a binary PPM. Returns 0 on success.
+int panel_sim_dump_ppm(esp_lcd_panel_io_handle_t io, const char *path);
+
+// Total of all vTaskDelay() calls so far, in milliseconds
+uint64_t panel_sim_delay_ms(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,304 @@
+/*
+ * Runs the sketch's SH8601 driver against the simulated panel IO and prints
+ * what went over the wire.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -Wall -Itools/panel_sim/include -I. -o panel_sim \
+ *      tools/panel_sim/panel_sim.c tools/panel_sim/panel_sim_main.c \
+ *      tools/panel_sim/esp_idf_shim.c esp_lcd_sh8601.c pixel_convert.c pclk_search.c
+ *   ./panel_sim [--pclk HZ] [--bpp 16|18|24] [--out frame.ppm] [--fail-above HZ]
+ *
+ * The program:
+ *   - brings the panel up with the board's init table,
+ *   - draws a test pattern with esp_lcd_panel_draw_bitmap() in draw buffer
+ *     sized bands, the way the direct flush path does,
+ *   - redraws a rectangle through esp_lcd_sh8601_set_window() and
+ *     esp_lcd_sh8601_write_pixels() in RAMWR + RAMWRC chunks, the way the
+ *     shadow flush path streams it,
+ *   - checks every pixel of the simulated frame and reports the transaction,
+ *     byte and wire time totals of each step,
+ *   - runs the clock calibration search against a panel that corrupts
+ *     transfers above --fail-above.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_commands.h"
+#include "esp_lcd_sh8601.h"
+#include "pixel_convert.h"
+#include "pclk_search.h"
+#include "panel_sim.h"
+
+#define WIDTH           536
+#define HEIGHT          240
+#define BAND_HEIGHT     (HEIGHT / 4)    // EXAMPLE_LVGL_BUF_HEIGHT
+#define STREAM_CHUNK    (8 * 1024)      // bytes per write_pixels() call
+
+// Mirrors lcd_init_cmds in display_init.cpp (TE lines left out, the board has no TE pin)
+static uint8_t init_colmod[1];
+static const sh8601_lcd_init_cmd_t lcd_init_cmds[] = {
+    {0x11, (uint8_t []){0x00}, 0, 120},
+    {0x36, (uint8_t []){0xF0}, 1, 0},
+    {0x3A, init_colmod, 1, 0},
+    {0x2A, (uint8_t []){0x00,0x00,0x02,0x17}, 4, 0},
+    {0x2B, (uint8_t []){0x00,0x00,0x00,0xEF}, 4, 0},
+    {0x51, (uint8_t []){0x00}, 1, 10},
+    {0x29, (uint8_t []){0x00}, 0, 10},
+    {0x51, (uint8_t []){0xFF}, 1, 0},
+};
+
+static uint16_t pattern(int x, int y)
+{
+    // gradients plus a checker so mirrored or shifted pixels show up
+    const uint16_t r = (uint16_t)((x * 31) / (WIDTH - 1));
+    const uint16_t g = (uint16_t)((y * 63) / (HEIGHT - 1));
+    const uint16_t b = (((x >> 3) ^ (y >> 3)) & 1) ? 31 : 0;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static void expected_rgb(uint16_t v, int bpp, uint8_t rgb[3])
+{
+    const uint8_t r = (v >> 11) & 0x1F, g = (v >> 5) & 0x3F, b = v & 0x1F;
+    if (bpp == 16) {
+        rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+        rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+        rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+    } else {
+        uint8_t wire[3];
+        if (bpp == 18) {
+            pixel_rgb565_to_rgb666_ref(wire, &v, 1);
+            for (int i = 0; i < 3; i++) {
+                wire[i] = (uint8_t)((wire[i] & 0xFC) | (wire[i] >> 6));
+            }
+        } else {
+            pixel_rgb565_to_rgb888_ref(wire, &v, 1);
+        }
+        memcpy(rgb, wire, 3);
+    }
+}
+
+// Converts native RGB565 to the panel's wire format, RGB565 going out high byte first
+static size_t to_wire(void *dst, const uint16_t *src, size_t count, int bpp)
+{
+    switch (bpp) {
+    case 24:
+        pixel_rgb565_to_rgb888((uint8_t *)dst, src, count);
+        return count * 3;
+    case 18:
+        pixel_rgb565_to_rgb666((uint8_t *)dst, src, count);
+        return count * 3;
+    default:
+        pixel_rgb565_swap((uint16_t *)dst, src, count);
+        return count * 2;
+    }
+}
+
+static void print_stats(const char *step, esp_lcd_panel_io_handle_t io)
+{
+    panel_sim_stats_t s;
+    panel_sim_get_stats(io, &s);
+    printf("%-10s cmd %5u  read %3u  color %4u  param %6llu B  color %8llu B  windows %4u  wire %8.3f ms\n",
+           step, s.cmd_transactions, s.read_transactions, s.color_transactions,
+           (unsigned long long)s.param_bytes, (unsigned long long)s.color_bytes,
+           s.windows, s.wire_ns / 1e6);
+    if (s.window_wraps || s.unknown_cmds || s.unsupported) {
+        printf("%-10s window wraps %u  unknown commands %u  unsupported %u\n",
+               "", s.window_wraps, s.unknown_cmds, s.unsupported);
+    }
+    panel_sim_reset_stats(io);
+}
+
+static int verify(esp_lcd_panel_io_handle_t io, int bpp, int x1, int y1, int x2, int y2, int shift)
+{
+    int bad = 0;
+    for (int y = y1; y < y2; y++) {
+        for (int x = x1; x < x2; x++) {
+            uint8_t got[3], want[3];
+            panel_sim_get_pixel(io, x, y, got);
+            expected_rgb(pattern(x + shift, y), bpp, want);
+            if (memcmp(got, want, 3)) {
+                if (bad < 5) {
+                    printf("  mismatch at %d,%d: %02X%02X%02X, expected %02X%02X%02X\n",
+                           x, y, got[0], got[1], got[2], want[0], want[1], want[2]);
+                }
+                bad++;
+            }
+        }
+    }
+    return bad;
+}
+
+typedef struct {
+    esp_lcd_panel_io_handle_t io;
+    int failures;
+} probe_ctx_t;
+
+// Same checks as lcdClockSelect(): RDDID against the baseline, then a brightness round trip
+static bool probe(uint32_t hz, void *arg)
+{
+    probe_ctx_t *ctx = (probe_ctx_t *)arg;
+    const uint8_t pattern_bytes[] = {0x55, 0xAA, 0x0F, 0xF0};
+    uint8_t id[3];
+
+    panel_sim_set_pclk(ctx->io, hz);
+    if (esp_lcd_sh8601_qspi_rx_param(ctx->io, LCD_CMD_RDDID, id, sizeof(id)) != ESP_OK ||
+            id[0] != 0x00 || id[1] != 0x80 || id[2] != 0x00) {
+        ctx->failures++;
+        return false;
+    }
+    for (size_t i = 0; i < sizeof(pattern_bytes); i++) {
+        uint8_t back = 0;
+        esp_lcd_sh8601_qspi_tx_param(ctx->io, LCD_CMD_WRDISBV, &pattern_bytes[i], 1);
+        esp_lcd_sh8601_qspi_rx_param(ctx->io, LCD_CMD_RDDISBV, &back, 1);
+        if (back != pattern_bytes[i]) {
+            ctx->failures++;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    panel_sim_config_t config = PANEL_SIM_DEFAULT_CONFIG();
+    uint32_t fail_above = 60 * 1000 * 1000;
+    const char *out = NULL;
+    int bpp = 16;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--pclk") && i + 1 < argc) {
+            config.pclk_hz = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (!strcmp(argv[i], "--bpp") && i + 1 < argc) {
+            bpp = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--out") && i + 1 < argc) {
+            out = argv[++i];
+        } else if (!strcmp(argv[i], "--fail-above") && i + 1 < argc) {
+            fail_above = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else {
+            fprintf(stderr, "usage: %s [--pclk HZ] [--bpp 16|18|24] [--out frame.ppm] [--fail-above HZ]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (bpp != 16 && bpp != 18 && bpp != 24) {
+        fprintf(stderr, "--bpp must be 16, 18 or 24\n");
+        return 2;
+    }
+    init_colmod[0] = bpp == 16 ? 0x55 : bpp == 18 ? 0x66 : 0x77;
+
+    esp_lcd_panel_io_handle_t io = NULL;
+    if (panel_sim_new_io(&config, &io) != ESP_OK) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    const sh8601_vendor_config_t vendor_config = {
+        .init_cmds = lcd_init_cmds,
+        .init_cmds_size = sizeof(lcd_init_cmds) / sizeof(lcd_init_cmds[0]),
+        .flags = {
+            .use_qspi_interface = 1,
+        },
+    };
+    const esp_lcd_panel_dev_config_t panel_config = {
+        .reset_gpio_num = -1,
+        .rgb_ele_order = LCD_RGB_ELEMENT_ORDER_RGB,
+        .bits_per_pixel = bpp,
+        .vendor_config = (void *)&vendor_config,
+    };
+    esp_lcd_panel_handle_t panel = NULL;
+    if (esp_lcd_new_panel_sh8601(io, &panel_config, &panel) != ESP_OK) {
+        fprintf(stderr, "esp_lcd_new_panel_sh8601 failed\n");
+        return 1;
+    }
+
+    printf("SH8601 %dx%d, %d bpp, %.1f MHz\n", WIDTH, HEIGHT, bpp, config.pclk_hz / 1e6);
+
+    esp_lcd_panel_reset(panel);
+    esp_lcd_panel_init(panel);
+    print_stats("init", io);
+    printf("%-10s %llu ms of delays\n", "", (unsigned long long)panel_sim_delay_ms());
+
+    const size_t wire_bpp = bpp == 16 ? 2 : 3;
+    uint16_t *band = malloc(WIDTH * BAND_HEIGHT * sizeof(uint16_t));
+    uint8_t *wire = malloc(WIDTH * BAND_HEIGHT * wire_bpp);
+    if (!band || !wire) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    // full frame in draw buffer sized bands
+    for (int y0 = 0; y0 < HEIGHT; y0 += BAND_HEIGHT) {
+        for (int y = 0; y < BAND_HEIGHT; y++) {
+            for (int x = 0; x < WIDTH; x++) {
+                band[y * WIDTH + x] = pattern(x, y0 + y);
+            }
+        }
+        to_wire(wire, band, WIDTH * BAND_HEIGHT, bpp);
+        esp_lcd_panel_draw_bitmap(panel, 0, y0, WIDTH, y0 + BAND_HEIGHT, wire);
+    }
+    print_stats("bands", io);
+    int bad = verify(io, bpp, 0, 0, WIDTH, HEIGHT, 0);
+
+    // a rectangle streamed in chunks that split pixels, shifted so the check sees the new content
+    const int rx1 = 100, ry1 = 40, rx2 = 420, ry2 = 200;
+    const int rw = rx2 - rx1, rh = ry2 - ry1;
+    size_t rect_bytes = 0;
+    uint8_t *rect = malloc((size_t)rw * rh * wire_bpp);
+    if (!rect) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (int y = 0; y < rh; y++) {
+        for (int x = 0; x < rw; x++) {
+            band[x] = pattern(rx1 + x + 8, ry1 + y);
+        }
+        rect_bytes += to_wire(rect + rect_bytes, band, rw, bpp);
+    }
+    esp_lcd_sh8601_set_window(panel, rx1, ry1, rx2, ry2);
+    for (size_t off = 0; off < rect_bytes; off += STREAM_CHUNK - 1) {
+        const size_t len = rect_bytes - off < STREAM_CHUNK - 1 ? rect_bytes - off : STREAM_CHUNK - 1;
+        esp_lcd_sh8601_write_pixels(panel, rect + off, len, off != 0);
+    }
+    print_stats("stream", io);
+    bad += verify(io, bpp, rx1, ry1, rx2, ry2, 8);
+
+    if (out) {
+        if (panel_sim_dump_ppm(io, out)) {
+            fprintf(stderr, "could not write %s\n", out);
+        } else {
+            printf("frame written to %s\n", out);
+        }
+    }
+
+    // calibration against a link that starts corrupting transfers above fail_above
+    static const uint32_t rates[] = {40000000, 48000000, 60000000, 80000000};
+    panel_sim_config_t flaky = PANEL_SIM_DEFAULT_CONFIG();
+    flaky.fail_above_hz = fail_above;
+    flaky.error_permille = 50;
+    probe_ctx_t ctx = { .failures = 0 };
+    if (panel_sim_new_io(&flaky, &ctx.io) != ESP_OK) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    const uint32_t chosen = pclk_search(rates, sizeof(rates) / sizeof(rates[0]), 20, probe, &ctx);
+    panel_sim_stats_t s;
+    panel_sim_get_stats(ctx.io, &s);
+    printf("calibrate  %.1f MHz chosen (errors above %.1f MHz), %u errors injected, %d failed probes, wire %.3f ms\n",
+           chosen / 1e6, fail_above / 1e6, s.errors_injected, ctx.failures, s.wire_ns / 1e6);
+
+    esp_lcd_panel_io_del(ctx.io);
+    esp_lcd_panel_del(panel);
+    esp_lcd_panel_io_del(io);
+    free(rect);
+    free(wire);
+    free(band);
+
+    if (bad) {
+        printf("FAIL: %d pixels differ\n", bad);
+        return 1;
+    }
+    printf("OK: frame matches\n");
+    return 0;
+}
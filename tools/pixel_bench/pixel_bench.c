@@ -0,0 +1,241 @@
+/*
+ * Checks the word-parallel pixel conversions and rotations in
+ * pixel_convert.c against their per-pixel _ref versions, then times both.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -Wall -I. -o pixel_bench tools/pixel_bench/pixel_bench.c pixel_convert.c
+ *   ./pixel_bench
+ *
+ * Every length up to a few words is run with the source and destination
+ * at each alignment the flush path can hand over, and in place, and must
+ * match the reference byte for byte without touching the bytes around the
+ * output. Rotations run at 0, 90, 180 and 270 degrees over sizes around
+ * the 16 pixel block, odd ones included, and both versions must land
+ * every pixel where the mapping in pixel_convert.h puts it. The times come
+ * from the host CPU; only the ratio between the kernels carries over to
+ * the ESP32-S3.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pixel_convert.h"
+
+#define MAX_PIXELS 67
+#define GUARD 8
+#define FILL 0xA5
+
+// A staging half of the flush path: a band of the 536 pixel wide panel
+#define BENCH_PIXELS (536 * 24)
+
+// Rotation sizes: below, at and past the 16 pixel block, odd ones fall back
+#define MAX_SIDE 50
+static const int sides[] = {1, 2, 3, 6, 15, 16, 18, 31, 32, 34, 50};
+static const int degreesList[] = {0, 90, 180, 270};
+
+typedef void (*RotateFn)(uint16_t *dst, const uint16_t *src, int w, int h, int degrees);
+
+typedef void (*ConvertFn)(uint8_t *dst, const uint16_t *src, size_t count);
+
+struct Kernel {
+    const char *name;
+    ConvertFn fast;
+    ConvertFn ref;
+    size_t outBytes;                    // per pixel
+};
+
+static void swapFast(uint8_t *dst, const uint16_t *src, size_t count) {
+    pixel_rgb565_swap((uint16_t *)dst, src, count);
+}
+
+static void swapRef(uint8_t *dst, const uint16_t *src, size_t count) {
+    pixel_rgb565_swap_ref((uint16_t *)dst, src, count);
+}
+
+static const struct Kernel kernels[] = {
+    {"swap565", swapFast, swapRef, 2},
+    {"565->666", pixel_rgb565_to_rgb666, pixel_rgb565_to_rgb666_ref, 3},
+    {"565->888", pixel_rgb565_to_rgb888, pixel_rgb565_to_rgb888_ref, 3},
+};
+
+static uint32_t rngState = 1;
+
+static uint16_t randomPixel(void) {
+    rngState = rngState * 1664525u + 1013904223u;
+    return (uint16_t)(rngState >> 16);
+}
+
+static int failures;
+
+static void fail(const struct Kernel *k, const char *what, size_t count, int srcOff, int dstOff) {
+    if (failures++ < 10) {
+        printf("FAIL %s %s: %zu pixels, src +%d, dst +%d\n", k->name, what, count, srcOff, dstOff);
+    }
+}
+
+// Output must match the reference and leave GUARD bytes on both sides alone
+static void checkCopy(const struct Kernel *k, size_t count, int srcOff, int dstOff) {
+    _Alignas(4) uint8_t srcBuf[MAX_PIXELS * 2 + 4];
+    _Alignas(4) uint8_t want[GUARD + MAX_PIXELS * 3 + 4 + GUARD];
+    _Alignas(4) uint8_t got[sizeof(want)];
+
+    uint16_t *src = (uint16_t *)(srcBuf + srcOff);
+    for (size_t i = 0; i < count; i++) {
+        src[i] = randomPixel();
+    }
+    memset(want, FILL, sizeof(want));
+    memset(got, FILL, sizeof(got));
+    k->ref(want + GUARD + dstOff, src, count);
+    k->fast(got + GUARD + dstOff, src, count);
+    if (memcmp(want, got, sizeof(want)) != 0) {
+        fail(k, "copy", count, srcOff, dstOff);
+    }
+}
+
+// dst == src, with room for the expanded output
+static void checkInPlace(const struct Kernel *k, size_t count, int off) {
+    _Alignas(4) uint8_t want[GUARD + MAX_PIXELS * 3 + 4 + GUARD];
+    _Alignas(4) uint8_t got[sizeof(want)];
+    _Alignas(4) uint8_t copy[sizeof(want)];
+
+    memset(want, FILL, sizeof(want));
+    uint16_t *pixels = (uint16_t *)(want + GUARD + off);
+    for (size_t i = 0; i < count; i++) {
+        pixels[i] = randomPixel();
+    }
+    memcpy(got, want, sizeof(want));
+    memcpy(copy, want, sizeof(want));
+
+    // The reference from a separate source is the ground truth
+    memset(want + GUARD + off, FILL, count * k->outBytes);
+    k->ref(want + GUARD + off, (const uint16_t *)(copy + GUARD + off), count);
+    k->fast(got + GUARD + off, (const uint16_t *)(got + GUARD + off), count);
+    // Bytes past the output hold leftover source either way, compare the output and guards only
+    if (memcmp(want, got, GUARD + off + count * k->outBytes) != 0 ||
+        memcmp(want + sizeof(want) - GUARD, got + sizeof(got) - GUARD, GUARD) != 0) {
+        fail(k, "in place", count, off, off);
+    }
+}
+
+// Where pixel_convert.h says input pixel (x, y) goes, as an output index
+static size_t rotatedIndex(int x, int y, int w, int h, int degrees) {
+    switch (degrees) {
+    case 90:
+        return (size_t)(w - 1 - x) * h + y;
+    case 180:
+        return (size_t)(h - 1 - y) * w + (w - 1 - x);
+    case 270:
+        return (size_t)x * h + (h - 1 - y);
+    default:
+        return (size_t)y * w + x;
+    }
+}
+
+static void checkRotate(const char *name, RotateFn fn, int w, int h, int degrees, int off) {
+    static _Alignas(4) uint8_t srcBuf[MAX_SIDE * MAX_SIDE * 2 + 4];
+    static _Alignas(4) uint16_t want[MAX_SIDE * MAX_SIDE + 2 * GUARD];
+    static _Alignas(4) uint8_t gotBuf[sizeof(want) + 4];
+
+    // Distinct pixels, so a pixel in the wrong place cannot match by chance
+    uint16_t *src = (uint16_t *)(srcBuf + off);
+    for (int i = 0; i < w * h; i++) {
+        src[i] = (uint16_t)(i * 7 + 1);
+    }
+    memset(want, FILL, sizeof(want));
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            want[GUARD + rotatedIndex(x, y, w, h, degrees)] = src[y * w + x];
+        }
+    }
+    uint16_t *got = (uint16_t *)(gotBuf + off);
+    memset(got, FILL, sizeof(want));
+    fn(got + GUARD, src, w, h, degrees);
+    if (memcmp(want, got, sizeof(want)) != 0 && failures++ < 10) {
+        printf("FAIL %s %d degrees: %dx%d, buffers +%d\n", name, degrees, w, h, off);
+    }
+}
+
+static double nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Mpixels per second over enough rounds to take a few tens of ms
+static double throughput(ConvertFn fn, uint8_t *dst, const uint16_t *src, uint32_t *checksum) {
+    const int rounds = 400;
+    const double start = nowNs();
+    for (int r = 0; r < rounds; r++) {
+        fn(dst, src, BENCH_PIXELS);
+        *checksum += dst[r % BENCH_PIXELS];
+    }
+    return (double)BENCH_PIXELS * rounds / (nowNs() - start) * 1e3;
+}
+
+static double rotateThroughput(RotateFn fn, uint16_t *dst, const uint16_t *src, int degrees, uint32_t *checksum) {
+    const int rounds = 400;
+    const double start = nowNs();
+    for (int r = 0; r < rounds; r++) {
+        fn(dst, src, 536, BENCH_PIXELS / 536, degrees);
+        *checksum += dst[r % BENCH_PIXELS];
+    }
+    return (double)BENCH_PIXELS * rounds / (nowNs() - start) * 1e3;
+}
+
+int main(void) {
+    const size_t kernelCount = sizeof(kernels) / sizeof(kernels[0]);
+    int checks = 0;
+
+    for (size_t k = 0; k < kernelCount; k++) {
+        for (size_t count = 0; count <= MAX_PIXELS; count++) {
+            // Sources are whole pixels, 2 bytes off is an unaligned word
+            for (int srcOff = 0; srcOff <= 2; srcOff += 2) {
+                for (int dstOff = 0; dstOff < 4; dstOff += kernels[k].outBytes == 2 ? 2 : 1) {
+                    checkCopy(&kernels[k], count, srcOff, dstOff);
+                    checks++;
+                }
+                checkInPlace(&kernels[k], count, srcOff);
+                checks++;
+            }
+        }
+    }
+    for (size_t d = 0; d < sizeof(degreesList) / sizeof(degreesList[0]); d++) {
+        for (size_t i = 0; i < sizeof(sides) / sizeof(sides[0]); i++) {
+            for (size_t j = 0; j < sizeof(sides) / sizeof(sides[0]); j++) {
+                // Two bytes off leaves the pixels unaligned to words
+                for (int off = 0; off <= 2; off += 2) {
+                    checkRotate("rotate_ref", pixel_rgb565_rotate_ref, sides[i], sides[j], degreesList[d], off);
+                    checkRotate("rotate", pixel_rgb565_rotate, sides[i], sides[j], degreesList[d], off);
+                    checks += 2;
+                }
+            }
+        }
+    }
+    printf("%d checks, %d failed\n", checks, failures);
+
+    uint16_t *src = malloc(BENCH_PIXELS * 2);
+    uint8_t *dst = malloc(BENCH_PIXELS * 3);
+    for (size_t i = 0; i < BENCH_PIXELS; i++) {
+        src[i] = randomPixel();
+    }
+    uint32_t checksum = 0;
+    printf("%-10s %10s %10s %8s\n", "kernel", "ref Mpx/s", "Mpx/s", "speedup");
+    for (size_t k = 0; k < kernelCount; k++) {
+        const double ref = throughput(kernels[k].ref, dst, src, &checksum);
+        const double fast = throughput(kernels[k].fast, dst, src, &checksum);
+        printf("%-10s %10.0f %10.0f %7.1fx\n", kernels[k].name, ref, fast, fast / ref);
+    }
+    for (size_t d = 1; d < sizeof(degreesList) / sizeof(degreesList[0]); d++) {
+        const double ref = rotateThroughput(pixel_rgb565_rotate_ref, (uint16_t *)dst, src, degreesList[d], &checksum);
+        const double fast = rotateThroughput(pixel_rgb565_rotate, (uint16_t *)dst, src, degreesList[d], &checksum);
+        printf("rotate %-3d %10.0f %10.0f %7.1fx\n", degreesList[d], ref, fast, fast / ref);
+    }
+    printf("%d pixels per call, rotations as 536x24 (checksum %u)\n", BENCH_PIXELS, checksum);
+
+    free(src);
+    free(dst);
+    return failures ? 1 : 0;
+}
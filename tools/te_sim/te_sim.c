@@ -0,0 +1,161 @@
+/*
+ * Drives the tearing-effect scheduler in te_pacing.c with simulated TE
+ * sources and a simulated flush task, on a virtual clock.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -Wall -I. -o te_sim tools/te_sim/te_sim.c te_pacing.c
+ *   ./te_sim
+ *
+ * The flush task does what te_sync.cpp does around every frame: ask how
+ * long to wait, wait for the next edge or the timeout, start the frame,
+ * write for a while, finish it. The edges it gets are jittered, dropped
+ * one at a time, or stop for a while. The simulation keeps its own count
+ * of frames an edge landed in and of waits that timed out, and the
+ * scheduler's missedDeadlines and waitTimeouts must match it. The period
+ * estimate must stay near the real period throughout.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "te_pacing.h"
+
+#define PERIOD_US       16667
+#define RUN_US          (20 * 1000 * 1000)
+#define MAX_EDGES       (RUN_US / 1000)
+
+struct Scenario {
+    const char *name;
+    int jitterUs;               // each edge off by up to this much either way
+    int dropPerMille;           // single edges the panel never signals
+    int64_t outageStartUs;      // no edges at all for a while, 0 for none
+    int64_t outageUs;
+    int frameMinUs;             // flush frame length, uniform
+    int frameMaxUs;
+    int gapMaxUs;               // idle time between frames, uniform from 0
+    int periodTolerancePct;     // how far the estimate may stray after the first second
+    bool expectMissed;
+    bool expectTimeouts;
+};
+
+static const struct Scenario scenarios[] = {
+    {"steady", 100, 0, 0, 0, 6000, 6000, 4000, 1, false, false},
+    {"jittered", 2000, 0, 0, 0, 4000, 18000, 6000, 3, true, false},
+    {"dropped edges", 300, 50, 0, 0, 6000, 9000, 4000, 2, false, false},
+    {"outage", 300, 0, 5000000, 400000, 6000, 9000, 4000, 2, false, true},
+    {"slow frames", 300, 0, 0, 0, 12000, 24000, 0, 2, true, false},
+};
+
+static uint32_t rngState = 1;
+
+static int randomBelow(int n) {
+    rngState = rngState * 1664525u + 1013904223u;
+    return n > 0 ? (int)((rngState >> 8) % (uint32_t)n) : 0;
+}
+
+static int64_t edges[MAX_EDGES];
+static int edgeCount;
+
+static void makeEdges(const struct Scenario *sc) {
+    edgeCount = 0;
+    for (int64_t nominal = PERIOD_US; nominal < RUN_US; nominal += PERIOD_US) {
+        if (sc->outageUs && nominal >= sc->outageStartUs && nominal < sc->outageStartUs + sc->outageUs) {
+            continue;
+        }
+        // Never two in a row, that would be an outage
+        const bool lastSent = edgeCount > 0 && edges[edgeCount - 1] > nominal - 2 * PERIOD_US;
+        if (lastSent && randomBelow(1000) < sc->dropPerMille) {
+            continue;
+        }
+        edges[edgeCount++] = nominal + randomBelow(2 * sc->jitterUs + 1) - sc->jitterUs;
+    }
+}
+
+static te_pacing_t pacing;
+static int nextEdge;
+static uint32_t worstPeriodErrorPct;
+
+// Delivers every edge up to now, like the ISR would have
+static void feedEdges(int64_t nowUs) {
+    while (nextEdge < edgeCount && edges[nextEdge] <= nowUs) {
+        te_pacing_edge(&pacing, edges[nextEdge++]);
+        if (edges[nextEdge - 1] > 1000000) {
+            const uint32_t err = abs((int)pacing.period_us - PERIOD_US) * 100 / PERIOD_US;
+            if (err > worstPeriodErrorPct) worstPeriodErrorPct = err;
+        }
+    }
+}
+
+static bool run(const struct Scenario *sc) {
+    makeEdges(sc);
+    te_pacing_init(&pacing, PERIOD_US);
+    nextEdge = 0;
+    worstPeriodErrorPct = 0;
+
+    bool ok = true;
+    uint32_t missed = 0, timeouts = 0;
+    int64_t now = 0;
+    // Stops short of the last edges, the source ends there and waits would time out
+    while (now < RUN_US - 4 * PERIOD_US) {
+        feedEdges(now);
+        if (pacing.edges > 0 && pacing.edges < 8 && te_pacing_refresh_period_ms(&pacing) != 0) {
+            printf("  refresh period reported after %u edges\n", pacing.edges);
+            ok = false;
+        }
+
+        const uint32_t waitUs = te_pacing_wait_us(&pacing, now);
+        bool edgeSeen = true;
+        if (waitUs > 0) {
+            if (nextEdge < edgeCount && edges[nextEdge] <= now + waitUs) {
+                now = edges[nextEdge];
+            } else {
+                now += waitUs;
+                edgeSeen = false;
+                timeouts++;
+            }
+            feedEdges(now);
+        }
+        te_pacing_frame_start(&pacing, now, edgeSeen);
+
+        const int edgesBefore = nextEdge;
+        now += sc->frameMinUs + randomBelow(sc->frameMaxUs - sc->frameMinUs + 1);
+        feedEdges(now);
+        if (nextEdge != edgesBefore) {
+            missed++;
+        }
+        te_pacing_frame_done(&pacing);
+        now += randomBelow(sc->gapMaxUs + 1);
+    }
+
+    printf("%-14s %6u %6u %7u %7u %8u %6u/%-6u %4u/%-4u %4u%%", sc->name, pacing.frames, pacing.edges,
+           pacing.period_us, pacing.jitter_us, pacing.start_latency_us, pacing.missed_deadlines, missed,
+           pacing.wait_timeouts, timeouts, worstPeriodErrorPct);
+
+    if (pacing.missed_deadlines != missed || pacing.wait_timeouts != timeouts) {
+        ok = false;
+    }
+    if ((missed > 0) != sc->expectMissed || (timeouts > 0) != sc->expectTimeouts) {
+        ok = false;
+    }
+    if (worstPeriodErrorPct > (uint32_t)sc->periodTolerancePct ||
+        te_pacing_refresh_period_ms(&pacing) != (PERIOD_US + 500) / 1000) {
+        ok = false;
+    }
+    printf("  %s\n", ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    printf("%-14s %6s %6s %7s %7s %8s %13s %9s %5s\n", "source", "frames", "edges", "period", "jitter", "latency",
+           "missed/sim", "tmo/sim", "err");
+    int failed = 0;
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        if (!run(&scenarios[i])) {
+            failed++;
+        }
+    }
+    printf("period and jitter in us, err is the worst period estimate error after the first second\n");
+    return failed ? 1 : 0;
+}
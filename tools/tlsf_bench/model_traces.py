@@ -0,0 +1,537 @@
+#!/usr/bin/env python3
+"""Write synthetic LVGL heap traces for tools/tlsf_bench.
+
+A sketch built with LVGL_MEM_TRACE in lv_conf.h prints the real trace. No
+capture from a panel exists yet; until one does, this writes the calls LVGL
+8.3 is expected to make for the widget tree screen_manager.cpp builds, so
+the checked-in traces follow the code: when ScreenManager creates or
+restyles widgets differently, change the matching function below and rerun.
+
+Sizes are those of LVGL 8.3 built for the ESP32 (32 bit pointers, 16 bit
+lv_coord_t) and are approximate; the draw buffers of a refresh are rougher
+still and style transitions are left out. Two traces are written:
+
+  screens.trace  lv_init() and display setup, ScreenManager::init() and the
+                 first frame, with the marks the sketch prints
+  updates.trace  state updates, button taps, swipes and the overview, in a
+                 fixed pseudo-random order
+
+Usage, from the sketch folder:
+  tools/tlsf_bench/model_traces.py [--rounds N] [--out-dir DIR]
+"""
+
+import argparse
+import os
+import random
+
+ROOT = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+# lv_mem_alloc() sizes, LVGL 8.3 on the ESP32
+OBJ = 40            # lv_obj_t, lv_btn_t adds nothing
+LABEL = 80          # lv_label_t
+BAR = 100           # lv_bar_t
+IMG = 64            # lv_img_t
+CANVAS = 84         # lv_canvas_t
+SPEC_ATTR = 28      # _lv_obj_spec_attr_t, with the first child or event
+EVENT_DSC = 12      # lv_event_dsc_t, per lv_obj_add_event_cb()
+STYLE_ENTRY = 8     # _lv_obj_style_t, per style on an object
+STYLE = 8           # lv_style_t of a local style
+PROP = 6            # lv_style_value_t and id, from the second property on
+LL_NODE = 8         # lv_ll links behind every list node
+TIMER = 24          # lv_timer_t
+ANIM = 76           # lv_anim_t
+DISP = 372          # lv_disp_t
+DRAW_CTX = 84       # lv_draw_sw_ctx_t
+INDEV = 92          # lv_indev_t
+IMG_DECODER = 20    # lv_img_decoder_t
+THEME = 540         # my_theme_t of lv_theme_default
+
+# Properties of each lv_theme_default style with the widgets lv_conf.h enables
+THEME_STYLE_PROPS = [
+    7, 1, 5, 15, 4, 4, 14, 2, 2, 6, 6, 6, 6, 2, 1, 1, 3, 3, 3, 3, 3, 3, 1, 1,
+    1, 2, 1, 1, 1, 1, 7, 5, 1, 9, 9, 3, 5, 3, 4, 7, 1,
+]
+
+# Properties of each ui_styles style, their arrays are on the LVGL heap too
+UI_STYLE_PROPS = [7, 2, 2, 2, 2, 1, 3, 1, 1, 3, 3]
+
+# Theme styles lv_theme_default adds to each class
+THEME_SCREEN = 3
+THEME_OBJ = 5
+THEME_BTN = 8
+THEME_BAR = 6
+THEME_LABEL = 0
+
+LV_PART_INDICATOR = 0x20000
+
+# config.h, the values NumericSprite pre-renders
+MIN_TEMPERATURE = 16
+MAX_TEMPERATURE = 30
+
+PANEL_WIDTH = 536
+# lv_draw_sw_letter.c caps a glyph's mask buffer
+LETTER_MASK_MAX = 2048
+
+
+class Trace:
+    """The T lines lvgl_mem.cpp prints, with made-up pointers."""
+
+    def __init__(self):
+        self.lines = []
+        self.next_ptr = 0x3c000000
+
+    def _ptr(self):
+        self.next_ptr += 0x10
+        return self.next_ptr
+
+    def alloc(self, size):
+        ptr = self._ptr()
+        self.lines.append(f"T a {ptr:#x} {size}")
+        return ptr
+
+    def realloc(self, ptr, size):
+        # lv_mem_realloc() frees on zero and allocates on zero_mem itself
+        if size == 0:
+            self.free(ptr)
+            return 0
+        if not ptr:
+            return self.alloc(size)
+        moved = self._ptr()
+        self.lines.append(f"T r {ptr:#x} {moved:#x} {size}")
+        return moved
+
+    def free(self, ptr):
+        if ptr:
+            self.lines.append(f"T f {ptr:#x}")
+
+    def mark(self, name):
+        self.lines.append(f"T m {name}")
+
+    def take(self):
+        lines, self.lines = self.lines, []
+        return lines
+
+
+class Style:
+    """lv_style_t: one property inline, more in an array grown per property."""
+
+    def __init__(self, ptr=0):
+        self.ptr = ptr
+        self.props = []
+        self.values = 0
+
+    def set(self, trace, prop):
+        if prop in self.props:
+            return
+        self.props.append(prop)
+        if len(self.props) > 1:
+            self.values = trace.realloc(self.values, PROP * len(self.props))
+
+
+class Obj:
+    def __init__(self, ptr):
+        self.ptr = ptr
+        self.styles = 0
+        self.style_count = 0
+        self.local = {}
+        self.spec_attr = 0
+        self.children = []
+        self.child_array = 0
+        self.events = 0
+        self.event_count = 0
+        self.text = 0
+
+
+class Lvgl:
+    """The LVGL calls ScreenManager makes, as the heap calls behind them."""
+
+    def __init__(self, trace):
+        self.trace = trace
+        self.screens = 0
+        self.screen_count = 0
+        self.bufs = []
+
+    def _ll_node(self, size):
+        return self.trace.alloc(size + LL_NODE)
+
+    def timer_create(self):
+        return self._ll_node(TIMER)
+
+    def _spec_attr(self, obj):
+        if not obj.spec_attr:
+            obj.spec_attr = self.trace.alloc(SPEC_ATTR)
+
+    def _add_style_entry(self, obj):
+        obj.style_count += 1
+        obj.styles = self.trace.realloc(obj.styles, STYLE_ENTRY * obj.style_count)
+
+    def obj_create(self, parent, size=OBJ, theme_styles=THEME_OBJ):
+        obj = Obj(self.trace.alloc(size))
+        if parent is None:
+            self.screen_count += 1
+            self.screens = self.trace.realloc(self.screens, 4 * self.screen_count)
+        else:
+            self._spec_attr(parent)
+            parent.children.append(obj)
+            parent.child_array = self.trace.realloc(parent.child_array, 4 * len(parent.children))
+        for _ in range(theme_styles):
+            self._add_style_entry(obj)
+        return obj
+
+    def screen_create(self):
+        return self.obj_create(None, theme_styles=THEME_SCREEN)
+
+    def btn_create(self, parent):
+        return self.obj_create(parent, theme_styles=THEME_BTN)
+
+    def bar_create(self, parent):
+        return self.obj_create(parent, BAR, THEME_BAR)
+
+    def label_create(self, parent):
+        label = self.obj_create(parent, LABEL, THEME_LABEL)
+        # The constructor sets LV_LABEL_DEFAULT_TEXT
+        self.label_set_text(label, "Text")
+        return label
+
+    def label_set_text(self, label, text):
+        self.trace.free(label.text)
+        label.text = self.trace.alloc(len(text.encode()) + 1)
+
+    def set_style(self, obj, *props, selector=0):
+        """lv_obj_set_style_*(): a local style per selector, first in the list."""
+        style = obj.local.get(selector)
+        if style is None:
+            self._add_style_entry(obj)
+            style = obj.local[selector] = Style(self.trace.alloc(STYLE))
+        for prop in props:
+            style.set(self.trace, prop)
+
+    def add_style(self, obj):
+        """lv_obj_add_style() of a shared style: only the entry is per object."""
+        self._add_style_entry(obj)
+
+    def set_pos(self, obj):
+        self.set_style(obj, "x", "y")
+
+    def set_size(self, obj):
+        self.set_style(obj, "width", "height")
+
+    def align(self, obj):
+        self.set_style(obj, "align", "x", "y")
+
+    def pad_all(self, obj):
+        self.set_style(obj, "pad_top", "pad_bottom", "pad_left", "pad_right")
+
+    def add_event_cb(self, obj):
+        self._spec_attr(obj)
+        obj.event_count += 1
+        obj.events = self.trace.realloc(obj.events, EVENT_DSC * obj.event_count)
+
+    def obj_del(self, parent, obj):
+        parent.children.remove(obj)
+        parent.child_array = self.trace.realloc(parent.child_array, 4 * len(parent.children))
+        for style in obj.local.values():
+            self.trace.free(style.values)
+            self.trace.free(style.ptr)
+        self.trace.free(obj.styles)
+        self.trace.free(obj.events)
+        self.trace.free(obj.spec_attr)
+        self.trace.free(obj.text)
+        self.trace.free(obj.ptr)
+
+    def anim_start(self):
+        return self._ll_node(ANIM)
+
+    def anim_end(self, anim):
+        self.trace.free(anim)
+
+    def _buf_get(self, size):
+        """lv_mem_buf_get(): the closest free slot that fits, else grow one."""
+        fits = [buf for buf in self.bufs if not buf["used"] and buf["size"] >= size]
+        if fits:
+            buf = min(fits, key=lambda b: b["size"])
+        else:
+            free = [buf for buf in self.bufs if not buf["used"]]
+            if free:
+                buf = free[0]
+                buf["ptr"] = self.trace.realloc(buf["ptr"], size)
+            else:
+                buf = {"ptr": self.trace.alloc(size)}
+                self.bufs.append(buf)
+            buf["size"] = size
+        buf["used"] = True
+        return buf
+
+    def draw(self, *draws):
+        """Draw calls, each holding its buffers while it runs."""
+        for sizes in draws:
+            held = [self._buf_get(size) for size in sizes]
+            for buf in held:
+                buf["used"] = False
+
+    def frame(self, *draws):
+        """One refresh: the draws, then lv_mem_buf_free_all() at its end."""
+        self.draw(*draws)
+        for buf in self.bufs:
+            self.trace.free(buf["ptr"])
+        self.bufs = []
+
+
+def letter(width, height):
+    return min(width * height, LETTER_MASK_MAX)
+
+
+# Draw calls of the areas ScreenManager redraws, as buffer sizes
+DRAW_SCREEN = [(PANEL_WIDTH,)]
+DRAW_BUTTON = [(160,), (160,), (letter(17, 22),)]
+DRAW_BIG_BUTTON = [(120,), (120,), (letter(56, 70),)]
+# The target temperature sprite is a plain copy from the atlas
+DRAW_TARGET = []
+DRAW_SPRITE_TEXT = [(letter(56, 70),), (letter(56, 70),)]
+DRAW_BAR = [(430,), (430,)]
+DRAW_TILE = [(258,), (258,), (letter(17, 22),), (letter(35, 48),), (letter(17, 22),)]
+
+
+class Ui:
+    def __init__(self):
+        self.container = None
+        self.screens = {}
+        self.target_label = None
+        self.bars = []
+        self.overview = None
+        self.values = []
+        self.details = []
+
+
+def boot(lv):
+    """lv_init(), displayInit() and lvglMemInit() up to the "display" mark."""
+    trace = lv.trace
+    lv.timer_create()                   # anim timer
+    lv._ll_node(IMG_DECODER)            # built-in image decoder
+
+    lv._ll_node(DISP)
+    trace.alloc(DRAW_CTX)
+    lv.timer_create()                   # refresh timer
+    trace.alloc(THEME)
+    for props in THEME_STYLE_PROPS:
+        style = Style()
+        for prop in range(props):
+            style.set(trace, prop)
+    active = lv.screen_create()
+    lv.screen_create()                  # top layer
+    lv.screen_create()                  # sys layer
+
+    lv._ll_node(INDEV)
+    lv.timer_create()                   # indev read timer
+    lv.timer_create()                   # lvgl_mem sample timer
+    trace.mark("display")
+    return active
+
+
+def create_button(lv, parent, text):
+    btn = lv.btn_create(parent)
+    lv.set_pos(btn)
+    lv.set_size(btn)
+    label = lv.label_create(btn)
+    lv.label_set_text(label, text)
+    lv.align(label)
+    return btn, label
+
+
+def create_label(lv, parent, text):
+    label = lv.label_create(parent)
+    lv.label_set_text(label, text)
+    lv.set_pos(label)
+    lv.add_style(label)
+    return label
+
+
+def create_bar(lv, parent):
+    bar = lv.bar_create(parent)
+    lv.set_pos(bar)
+    lv.set_style(bar, "width")
+    lv.set_style(bar, "height")
+    lv.add_style(bar)
+    lv.add_style(bar)
+    return bar
+
+
+def create_panel(lv, parent):
+    panel = lv.obj_create(parent)
+    lv.set_size(panel)
+    lv.add_style(panel)
+    return panel
+
+
+def create_light_screen(lv, ui):
+    screen = ui.screens["light"] = create_panel(lv, ui.container)
+    create_label(lv, screen, "B")
+    bar = create_bar(lv, screen)
+    lv.add_event_cb(bar)
+    lv.add_event_cb(bar)
+    ui.bars.append(bar)
+    create_label(lv, screen, "C")
+    bar = create_bar(lv, screen)
+    lv.add_event_cb(bar)
+    lv.add_event_cb(bar)
+    ui.bars.append(bar)
+    create_label(lv, screen, "")
+    create_label(lv, screen, "")
+
+
+def create_hvac_screen(lv, ui):
+    screen = ui.screens["hvac"] = create_panel(lv, ui.container)
+    for text in ("OFF", "COOL"):
+        btn, _ = create_button(lv, screen, text)
+        lv.add_style(btn)
+        lv.add_style(btn)           # checked
+        lv.add_event_cb(btn)
+    for text in ("-", "+"):
+        btn, _ = create_button(lv, screen, text)
+        lv.add_style(btn)
+        lv.add_event_cb(btn)
+    ui.target_label = lv.label_create(screen)
+    lv.align(ui.target_label)
+    lv.add_style(ui.target_label)
+    sprite = numeric_sprite_init(lv, screen, MAX_TEMPERATURE - MIN_TEMPERATURE + 1)
+    lv.align(sprite)
+
+
+def numeric_sprite_init(lv, parent, count):
+    """NumericSprite::init(): every value drawn through a throwaway canvas."""
+    canvas = lv.obj_create(parent, CANVAS, 0)
+    for _ in range(count):
+        # lv_canvas_draw_text() sets up a fake display with its own draw context
+        ctx = lv.trace.alloc(DRAW_CTX)
+        lv.draw(*DRAW_SPRITE_TEXT)
+        lv.trace.free(ctx)
+    lv.obj_del(parent, canvas)
+    img = lv.obj_create(parent, IMG, 0)
+    lv.set_size(img)
+    return img
+
+
+def create_overview(lv, ui):
+    ui.overview = create_panel(lv, ui.container)
+    for name in ("Light Control", "HVAC Control"):
+        tile, title = create_button(lv, ui.overview, name)
+        lv.add_style(tile)
+        lv.add_event_cb(tile)
+        lv.align(title)
+        ui.values.append(lv.label_create(tile))
+        lv.label_set_text(ui.values[-1], "--")
+        lv.add_style(ui.values[-1])
+        lv.align(ui.values[-1])
+        ui.details.append(lv.label_create(tile))
+        lv.label_set_text(ui.details[-1], "")
+        lv.align(ui.details[-1])
+
+
+def screen_manager_init(lv, ui, active):
+    """ScreenManager::init() up to the "screens" mark, then the first frame."""
+    # uiStylesInit()
+    for props in UI_STYLE_PROPS:
+        style = Style()
+        for prop in range(props):
+            style.set(lv.trace, prop)
+    ui.container = lv.screen_create()
+    lv.add_style(ui.container)
+    create_light_screen(lv, ui)
+    create_hvac_screen(lv, ui)
+    create_overview(lv, ui)
+    # lv_scr_load() puts both screens at 0,0 through local styles
+    lv.set_pos(ui.container)
+    lv.set_pos(active)
+    lv.timer_create()                   # idle view timer
+    lv.timer_create()                   # UI queue timer
+    lv.trace.mark("screens")
+
+    lv.frame(*DRAW_SCREEN, *DRAW_BUTTON, *DRAW_BUTTON, *DRAW_BIG_BUTTON, *DRAW_BIG_BUTTON,
+             *DRAW_TARGET)
+    lv.trace.mark("first-frame")
+
+
+def updates(lv, ui, rounds, rng):
+    """What the UI queue timer, taps and gestures do, with the frames they cause."""
+    temp = 22
+    screen = "hvac"
+    overview = False
+    for i in range(1, rounds + 1):
+        event = rng.random()
+        if event < 0.35:
+            # HVAC state. How often it repeats what is shown is a guess,
+            # not a capture: the mode buttons only redraw when the checked
+            # state moves, the target when the sprite changes
+            new_temp = rng.randint(MIN_TEMPERATURE, MAX_TEMPERATURE) if rng.random() < 0.3 else temp
+            mode_changed = rng.random() < 0.1
+            draws = (DRAW_BUTTON + DRAW_BUTTON if mode_changed else []) + \
+                (DRAW_TARGET if new_temp != temp else [])
+            if screen == "hvac" and not overview and (mode_changed or new_temp != temp):
+                lv.frame(*draws)
+            temp = new_temp
+        elif event < 0.6:
+            # Light state: the bars only move their values
+            if screen == "light" and not overview:
+                lv.frame(*DRAW_BAR, *DRAW_BAR)
+        elif event < 0.75:
+            # Temperature button tap
+            if screen == "hvac" and not overview:
+                temp = max(MIN_TEMPERATURE, min(MAX_TEMPERATURE, temp + rng.choice((-1, 1))))
+                lv.frame(*DRAW_BIG_BUTTON, *DRAW_TARGET)
+                lv.frame(*DRAW_BIG_BUTTON)
+        elif event < 0.9:
+            # Swipe: setSwipeOffset() moves both screens through local y
+            if not overview:
+                target = "light" if screen == "hvac" else "hvac"
+                lv.set_style(ui.screens[screen], "y")
+                lv.set_style(ui.screens[target], "y")
+                anim = lv.anim_start()
+                for _ in range(rng.randint(6, 12)):
+                    lv.frame(*DRAW_SCREEN, *DRAW_SCREEN, *DRAW_BAR, *DRAW_BUTTON, *DRAW_TARGET)
+                lv.anim_end(anim)
+                screen = target
+                lv.frame(*DRAW_SCREEN)
+        else:
+            # Pinch opens the overview, a tile tap closes it
+            overview = not overview
+            if overview:
+                for label, text in zip(ui.values + ui.details,
+                                       (f"{rng.randint(0, 100)}%", f"{temp}",
+                                        f"{rng.randint(2700, 6500)}K", rng.choice(("off", "cool")))):
+                    lv.label_set_text(label, text)
+                lv.frame(*DRAW_SCREEN, *DRAW_TILE, *DRAW_TILE)
+            else:
+                lv.frame(*DRAW_SCREEN)
+        if i % (rounds // 5) == 0:
+            lv.trace.mark(f"updates-{i}")
+
+
+def write(path, lines):
+    with open(path, "w") as f:
+        f.write("# synthetic, written by tools/tlsf_bench/model_traces.py\n")
+        f.write("\n".join(lines) + "\n")
+    print(f"{os.path.relpath(path, ROOT)}: {len(lines)} lines")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--rounds", type=int, default=1000,
+                        help="update events in updates.trace")
+    parser.add_argument("--out-dir", default=os.path.join(ROOT, "tools", "tlsf_bench", "traces"),
+                        help="where to write the traces")
+    args = parser.parse_args()
+
+    trace = Trace()
+    lv = Lvgl(trace)
+    ui = Ui()
+    screen_manager_init(lv, ui, boot(lv))
+    screens = trace.take()
+    updates(lv, ui, args.rounds, random.Random(1))
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    write(os.path.join(args.out_dir, "screens.trace"), screens)
+    write(os.path.join(args.out_dir, "updates.trace"), trace.take())
+
+
+if __name__ == "__main__":
+    main()
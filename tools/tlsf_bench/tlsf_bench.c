@@ -0,0 +1,221 @@
+/*
+ * Replays LVGL heap traces through LVGL's own TLSF allocator, in a pool set
+ * up the way lv_mem_init() does it and reported the way lv_mem_monitor()
+ * and lvgl_mem.cpp report it on the panel.
+ *
+ * Build and run from the repository root, with LVGL 8.3 in $LVGL (the
+ * Arduino library folder will do):
+ *
+ *   cc -O2 -Wall -DLV_CONF_INCLUDE_SIMPLE -I. -I$LVGL/src/misc -o tlsf_bench \
+ *      tools/tlsf_bench/tlsf_bench.c $LVGL/src/misc/lv_tlsf.c
+ *   ./tlsf_bench tools/tlsf_bench/traces/screens.trace tools/tlsf_bench/traces/updates.trace
+ *
+ * A trace is the "T" lines a sketch built with LVGL_MEM_TRACE in lv_conf.h
+ * prints, so a whole serial capture can be passed in; other lines are
+ * skipped. The checked-in traces are synthetic: no capture from a panel
+ * exists yet, and tools/tlsf_bench/model_traces.py writes them from a model
+ * of the widget tree. Replace them with a capture when one is taken.
+ *
+ *   T a <ptr> <size>           lv_mem_alloc()
+ *   T r <ptr> <new ptr> <size> lv_mem_realloc(), <ptr> 0x0 allocates
+ *   T f <ptr>                  lv_mem_free()
+ *   T m <name>                 lvglMemTraceMark(), prints the heap state
+ *
+ * Files are replayed in order into one pool, the way boot is followed by
+ * use. The heap is walked after every call, so the low points are exact
+ * rather than sampled once a second like on the panel.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lv_conf.h"
+#include "lv_tlsf.h"
+
+// Referenced by lv_tlsf.c's asserts and error log
+void _lv_log_add(int8_t level, const char *file, int line, const char *func, const char *format, ...) {
+    fprintf(stderr, "lv_tlsf: error in %s:%d\n", file, line);
+}
+
+void *lv_memcpy(void *dst, const void *src, size_t len) {
+    return memcpy(dst, src, len);
+}
+
+void lv_memset(void *dst, uint8_t v, size_t len) {
+    memset(dst, v, len);
+}
+
+// Trace pointer to the block the replay got for it
+#define MAP_SLOTS (1 << 16)
+
+struct Slot {
+    uint64_t key;
+    void *block;
+};
+
+static struct Slot map[MAP_SLOTS];
+
+static struct Slot *findSlot(uint64_t key) {
+    uint32_t i = (uint32_t)((key >> 2) * 2654435761u) & (MAP_SLOTS - 1);
+    while (map[i].key && map[i].key != key) {
+        i = (i + 1) & (MAP_SLOTS - 1);
+    }
+    return &map[i];
+}
+
+static void *lookup(uint64_t key) {
+    return key ? findSlot(key)->block : NULL;
+}
+
+static void forget(uint64_t key) {
+    // Backward shift delete keeps the probe chains intact
+    struct Slot *slot = findSlot(key);
+    if (!slot->key) return;
+    uint32_t i = (uint32_t)(slot - map);
+    for (uint32_t j = (i + 1) & (MAP_SLOTS - 1); map[j].key; j = (j + 1) & (MAP_SLOTS - 1)) {
+        const uint32_t home = (uint32_t)((map[j].key >> 2) * 2654435761u) & (MAP_SLOTS - 1);
+        if (((j - home) & (MAP_SLOTS - 1)) >= ((j - i) & (MAP_SLOTS - 1))) {
+            map[i] = map[j];
+            i = j;
+        }
+    }
+    map[i].key = 0;
+    map[i].block = NULL;
+}
+
+static void remember(uint64_t key, void *block) {
+    struct Slot *slot = findSlot(key);
+    slot->key = key;
+    slot->block = block;
+}
+
+// What lv_mem_monitor() fills in, from the same pool walk
+struct Monitor {
+    uint32_t freeSize;
+    uint32_t freeBiggest;
+    uint32_t freeCount;
+    uint32_t usedCount;
+};
+
+static void walker(void *ptr, size_t size, int used, void *user) {
+    struct Monitor *mon = (struct Monitor *)user;
+    if (used) {
+        mon->usedCount++;
+    } else {
+        mon->freeCount++;
+        mon->freeSize += size;
+        if (size > mon->freeBiggest) mon->freeBiggest = size;
+    }
+}
+
+static lv_tlsf_t tlsf;
+static uint32_t calls, failed, unknown, minFree = UINT32_MAX, minBiggest = UINT32_MAX;
+
+static struct Monitor sample(void) {
+    struct Monitor mon = {0};
+    lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), walker, &mon);
+    if (mon.freeSize < minFree) minFree = mon.freeSize;
+    if (mon.freeBiggest < minBiggest) minBiggest = mon.freeBiggest;
+    return mon;
+}
+
+static void report(const char *point) {
+    const struct Monitor mon = sample();
+    const uint32_t fragPct = mon.freeSize ? 100 - mon.freeBiggest * 100 / mon.freeSize : 0;
+    printf("%-24s %6u %6u %8u %8u %8u %8u %6u %6u\n", point, calls, mon.usedCount, mon.freeSize, minFree,
+           mon.freeBiggest, minBiggest, mon.freeCount, fragPct);
+}
+
+static void replayLine(const char *line) {
+    unsigned long long ptr, moved;
+    unsigned size;
+    char name[64];
+
+    switch (line[2]) {
+    case 'a': {
+        if (sscanf(line + 3, "%llx %u", &ptr, &size) != 2) return;
+        void *block = lv_tlsf_malloc(tlsf, size);
+        if (!block) {
+            failed++;
+        } else if (ptr) {
+            remember(ptr, block);
+        }
+        break;
+    }
+    case 'r': {
+        if (sscanf(line + 3, "%llx %llx %u", &ptr, &moved, &size) != 3) return;
+        void *block = lookup(ptr);
+        if (ptr && !block) {
+            unknown++;
+        }
+        void *grown = lv_tlsf_realloc(tlsf, block, size);
+        if (!grown) {
+            failed++;
+            break;
+        }
+        forget(ptr);
+        if (moved) remember(moved, grown);
+        break;
+    }
+    case 'f': {
+        if (sscanf(line + 3, "%llx", &ptr) != 1) return;
+        void *block = lookup(ptr);
+        if (!block) {
+            if (ptr) unknown++;
+            return;
+        }
+        lv_tlsf_free(tlsf, block);
+        forget(ptr);
+        break;
+    }
+    case 'm':
+        if (sscanf(line + 3, "%63s", name) == 1) report(name);
+        return;
+    default:
+        return;
+    }
+    calls++;
+    sample();
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s trace...\n", argv[0]);
+        return 2;
+    }
+
+    // lv_mem_init() with LV_MEM_POOL_ALLOC: the control block and the pool
+    // share the LV_MEM_SIZE bytes lvglMemPoolAlloc() returns
+    void *mem = malloc(LV_MEM_SIZE);
+    tlsf = lv_tlsf_create_with_pool(mem, LV_MEM_SIZE);
+
+    printf("LV_MEM_SIZE %u bytes, all sizes in bytes\n", (unsigned)LV_MEM_SIZE);
+    printf("%-24s %6s %6s %8s %8s %8s %8s %6s %6s\n", "point", "calls", "blocks", "free", "low free",
+           "largest", "low larg", "pieces", "frag%");
+    report("empty");
+
+    for (int i = 1; i < argc; i++) {
+        FILE *f = fopen(argv[i], "r");
+        if (!f) {
+            perror(argv[i]);
+            return 1;
+        }
+        char line[256];
+        while (fgets(line, sizeof(line), f)) {
+            if (line[0] == 'T' && line[1] == ' ') {
+                replayLine(line);
+            }
+        }
+        fclose(f);
+
+        const char *base = strrchr(argv[i], '/');
+        report(base ? base + 1 : argv[i]);
+    }
+
+    if (failed || unknown) {
+        printf("%u allocations failed, %u calls named a pointer the trace never allocated\n", failed, unknown);
+    }
+    free(mem);
+    return failed ? 1 : 0;
+}
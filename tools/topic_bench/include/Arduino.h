@@ -0,0 +1,14 @@
+/*
+ * Host stand-in for the Arduino core, only Serial
+ */
+#pragma once
+
+#include <stdio.h>
+
+struct HostSerial {
+    void println(const char *s) { puts(s); }
+    template <typename... Args>
+    void printf(const char *fmt, Args... args) { ::printf(fmt, args...); }
+};
+
+static HostSerial Serial;
@@ -0,0 +1,220 @@
+/*
+ * Compares routing an incoming MQTT topic through the TopicRouter trie
+ * with the strcmp chain processMessage used to walk, at 2, 50 and 500
+ * entity topics of the length Home Assistant uses.
+ *
+ * Build and run from the repository root:
+ *
+ *   c++ -O2 -Wall -Itools/topic_bench/include -I. -o topic_bench \
+ *       tools/topic_bench/topic_bench.cpp topic_router.cpp
+ *   ./topic_bench
+ *
+ * Every lookup is checked against the strcmp chain first, wildcard
+ * routes included, so the timings only compare equal answers.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#include "topic_router.h"
+
+static const char *DOMAINS[] = {"light", "climate", "sensor", "switch", "cover"};
+
+static uint32_t handled = 0;
+
+static void countHandler(uint8_t slot, const char *, const char *, size_t) {
+    handled += slot + 1;
+}
+
+// The old way: compare with every configured topic in turn
+static const TopicRoute *linearMatch(const std::vector<TopicRoute> &routes, const char *topic) {
+    for (const TopicRoute &route : routes) {
+        if (strcmp(topic, route.pattern) == 0) {
+            return &route;
+        }
+    }
+    return NULL;
+}
+
+// MQTT wildcard matching for the check, level by level
+static bool patternMatches(const char *pattern, const char *topic) {
+    if (topic[0] == '$' && (pattern[0] == '+' || pattern[0] == '#')) {
+        return false;
+    }
+    while (true) {
+        if (pattern[0] == '#' && pattern[1] == '\0') {
+            return true;
+        }
+        const char *pe = strchr(pattern, '/');
+        const char *te = strchr(topic, '/');
+        const size_t pn = pe ? (size_t)(pe - pattern) : strlen(pattern);
+        const size_t tn = te ? (size_t)(te - topic) : strlen(topic);
+        if (!(pn == 1 && pattern[0] == '+') && (pn != tn || memcmp(pattern, topic, pn) != 0)) {
+            return false;
+        }
+        if (!pe || !te) {
+            // "a/#" also matches "a"
+            return !pe && !te ? true : (!te && strcmp(pe, "/#") == 0);
+        }
+        pattern = pe + 1;
+        topic = te + 1;
+    }
+}
+
+static int specificity(const char *pattern) {
+    int score = 0;
+    for (const char *c = pattern; *c; c++) {
+        score += *c == '+' ? 1 : *c == '#' ? 100 : 0;
+    }
+    return score;
+}
+
+// What the router should answer: exact match first, otherwise the most specific wildcard
+static const TopicRoute *expectedMatch(const std::vector<TopicRoute> &routes, const char *topic) {
+    const TopicRoute *best = linearMatch(routes, topic);
+    for (const TopicRoute &route : routes) {
+        if (!best && patternMatches(route.pattern, topic)) {
+            best = &route;
+        } else if (best && patternMatches(route.pattern, topic) &&
+                   specificity(route.pattern) < specificity(best->pattern)) {
+            best = &route;
+        }
+    }
+    return best;
+}
+
+static double nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static bool runCase(int entities) {
+    std::vector<std::string> patterns;
+    for (int i = 0; i < entities; i++) {
+        const char *domain = DOMAINS[i % 5];
+        char topic[96];
+        snprintf(topic, sizeof(topic), "homeassistant/%s/%s.simroom_entity_%03d/state", domain, domain, i);
+        patterns.push_back(topic);
+    }
+    std::vector<TopicRoute> routes;
+    for (size_t i = 0; i < patterns.size(); i++) {
+        routes.push_back({patterns[i].c_str(), countHandler, (uint8_t)i});
+    }
+
+    // What a panel receives: its topics in random order, a few it does not know
+    std::vector<std::string> incoming;
+    srand(entities);
+    for (int i = 0; i < 4096; i++) {
+        if (i % 16 == 15) {
+            incoming.push_back("homeassistant/sensor/sensor.elsewhere_" + std::to_string(i) + "/state");
+        } else {
+            incoming.push_back(patterns[rand() % entities]);
+        }
+    }
+
+    TopicRouter router;
+    if (!router.init(routes.data(), routes.size())) {
+        return false;
+    }
+    for (const std::string &topic : incoming) {
+        if (router.match(topic.c_str(), topic.size()) != linearMatch(routes, topic.c_str())) {
+            fprintf(stderr, "router and strcmp chain disagree on %s\n", topic.c_str());
+            return false;
+        }
+    }
+
+    const int rounds = 50;
+    double start = nowNs();
+    for (int r = 0; r < rounds; r++) {
+        for (const std::string &topic : incoming) {
+            const TopicRoute *route = linearMatch(routes, topic.c_str());
+            if (route) {
+                route->handler(route->slot, topic.c_str(), "", 0);
+            }
+        }
+    }
+    const double linearNs = (nowNs() - start) / (rounds * incoming.size());
+
+    start = nowNs();
+    for (int r = 0; r < rounds; r++) {
+        for (const std::string &topic : incoming) {
+            router.dispatch(topic.c_str(), "", 0);
+        }
+    }
+    const double trieNs = (nowNs() - start) / (rounds * incoming.size());
+
+    printf("%8d %14.0f %14.0f\n", entities, linearNs, trieNs);
+    return true;
+}
+
+// Wildcards against a reference matcher, including the MQTT corner cases
+static bool checkWildcards() {
+    const std::vector<TopicRoute> routes = {
+        {"homeassistant/light/light.desk/state", countHandler, 0},
+        {"homeassistant/light/+/state", countHandler, 1},
+        {"homeassistant/+/+/availability", countHandler, 2},
+        {"homeassistant/climate/#", countHandler, 3},
+        {"homeassistant/status", countHandler, 4},
+        {"#", countHandler, 5},
+        {"$SYS/broker/uptime", countHandler, 6},
+    };
+    const char *topics[] = {
+        "homeassistant/light/light.desk/state",
+        "homeassistant/light/light.hall/state",
+        "homeassistant/light/light.hall/availability",
+        "homeassistant/climate",
+        "homeassistant/climate/climate.room/state",
+        "homeassistant/status",
+        "homeassistant/status/extra",
+        "homeassistant/light/light.hall",
+        "$SYS/broker/uptime",
+        "$SYS/broker/load",
+        "",
+        "a//b",
+    };
+
+    TopicRouter router;
+    if (!router.init(routes.data(), routes.size())) {
+        return false;
+    }
+    bool ok = true;
+    for (const char *topic : topics) {
+        const TopicRoute *got = router.match(topic, strlen(topic));
+        const TopicRoute *want = expectedMatch(routes, topic);
+        if (got != want) {
+            fprintf(stderr, "%-45s router %-36s expected %s\n", topic, got ? got->pattern : "(none)",
+                    want ? want->pattern : "(none)");
+            ok = false;
+        }
+    }
+
+    const TopicRoute bad[] = {{"a/#/b", countHandler, 0}, {"a/b+", countHandler, 0}};
+    for (const TopicRoute &route : bad) {
+        TopicRouter rejecting;
+        if (rejecting.init(&route, 1)) {
+            fprintf(stderr, "accepted invalid pattern %s\n", route.pattern);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int main() {
+    if (!checkWildcards()) {
+        return 1;
+    }
+    printf("wildcard routes match the reference\n");
+
+    printf("%8s %14s %14s\n", "topics", "strcmp ns/msg", "trie ns/msg");
+    for (int entities : {2, 50, 500}) {
+        if (!runCase(entities)) {
+            return 1;
+        }
+    }
+    printf("(%u handler calls)\n", handled);
+    return 0;
+}
@@ -0,0 +1,200 @@
+#include "topic_router.h"
+#include <Arduino.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const uint16_t EMPTY = 0xffff;
+
+// FNV-1a over one topic level
+static uint32_t levelHash(const char* level, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)level[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t slotOf(uint16_t parent, uint32_t hash) {
+    const uint32_t h = (hash ^ (parent * 0x9e3779b1u)) * 0x85ebca6bu;
+    return h ^ (h >> 15);
+}
+
+static size_t levelLength(const char* level, size_t remaining) {
+    const char* slash = (const char*)memchr(level, '/', remaining);
+    return slash ? (size_t)(slash - level) : remaining;
+}
+
+TopicRouter::~TopicRouter() {
+    release();
+}
+
+void TopicRouter::release() {
+    free(nodes);
+    free(table);
+    nodes = nullptr;
+    table = nullptr;
+    nodeCount = 0;
+    routeCount = 0;
+}
+
+int TopicRouter::findChild(uint16_t parent, uint32_t hash, const char* level, size_t length) const {
+    for (uint32_t i = slotOf(parent, hash);; i++) {
+        const uint16_t index = table[i & tableMask];
+        if (index == EMPTY) {
+            return -1;
+        }
+        const Node& node = nodes[index];
+        if (node.parent == parent && node.hash == hash && node.levelLength == length &&
+            memcmp(node.level, level, length) == 0) {
+            return index;
+        }
+    }
+}
+
+int TopicRouter::addChild(uint16_t parent, const char* level, size_t length) {
+    Node& owner = nodes[parent];
+    int16_t* wildcard = nullptr;
+    if (length == 1 && level[0] == '+') {
+        wildcard = &owner.single;
+    } else if (length == 1 && level[0] == '#') {
+        wildcard = &owner.multi;
+    }
+    
+    const uint32_t hash = levelHash(level, length);
+    int existing = wildcard ? *wildcard : findChild(parent, hash, level, length);
+    if (existing >= 0) {
+        return existing;
+    }
+    
+    const uint16_t index = nodeCount++;
+    Node& node = nodes[index];
+    node = Node();
+    node.level = level;
+    node.levelLength = length;
+    node.hash = hash;
+    node.parent = parent;
+    if (wildcard) {
+        *wildcard = index;
+    } else {
+        uint32_t i = slotOf(parent, hash);
+        while (table[i & tableMask] != EMPTY) {
+            i++;
+        }
+        table[i & tableMask] = index;
+    }
+    return index;
+}
+
+bool TopicRouter::init(const TopicRoute* newRoutes, size_t count) {
+    release();
+    
+    // One node per pattern level at most, plus the root
+    size_t maxNodes = 1;
+    for (size_t r = 0; r < count; r++) {
+        maxNodes++;
+        for (const char* c = newRoutes[r].pattern; *c; c++) {
+            maxNodes += *c == '/';
+        }
+    }
+    if (maxNodes >= EMPTY || count > INT16_MAX) {
+        Serial.println("Too many MQTT routes");
+        return false;
+    }
+    size_t tableSize = 16;
+    while (tableSize < maxNodes * 2) {
+        tableSize <<= 1;
+    }
+    
+    nodes = (Node*)calloc(maxNodes, sizeof(Node));
+    table = (uint16_t*)malloc(tableSize * sizeof(uint16_t));
+    if (!nodes || !table) {
+        Serial.println("No memory for the MQTT topic router");
+        release();
+        return false;
+    }
+    memset(table, 0xff, tableSize * sizeof(uint16_t));
+    tableMask = tableSize - 1;
+    nodes[0] = Node();
+    nodeCount = 1;
+    
+    for (size_t r = 0; r < count; r++) {
+        const char* pattern = newRoutes[r].pattern;
+        const size_t length = strlen(pattern);
+        uint16_t node = 0;
+        bool valid = true;
+        
+        for (size_t pos = 0; pos <= length && valid;) {
+            const size_t n = levelLength(pattern + pos, length - pos);
+            const char* level = pattern + pos;
+            // Wildcards fill a whole level, "#" only the last one
+            if ((memchr(level, '+', n) || memchr(level, '#', n)) && n != 1) {
+                valid = false;
+            } else if (level[0] == '#' && n == 1 && pos + n != length) {
+                valid = false;
+            }
+            node = addChild(node, level, n);
+            pos += n + 1;
+        }
+        
+        if (!valid || nodes[node].route >= 0) {
+            Serial.printf("Bad or duplicate MQTT route: %s\n", pattern);
+            release();
+            return false;
+        }
+        nodes[node].route = r;
+    }
+    
+    routes = newRoutes;
+    routeCount = count;
+    return true;
+}
+
+int TopicRouter::matchFrom(uint16_t index, const char* topic, size_t pos, size_t length) const {
+    const Node& node = nodes[index];
+    
+    // Every level consumed; "a/#" also matches "a"
+    if (pos > length) {
+        if (node.route >= 0) {
+            return node.route;
+        }
+        return node.multi >= 0 ? nodes[node.multi].route : -1;
+    }
+    
+    const size_t n = levelLength(topic + pos, length - pos);
+    const int child = findChild(index, levelHash(topic + pos, n), topic + pos, n);
+    if (child >= 0) {
+        const int route = matchFrom(child, topic, pos + n + 1, length);
+        if (route >= 0) {
+            return route;
+        }
+    }
+    
+    // Wildcards never match the first level of "$SYS"-style topics
+    if (pos == 0 && topic[0] == '$') {
+        return -1;
+    }
+    if (node.single >= 0) {
+        const int route = matchFrom(node.single, topic, pos + n + 1, length);
+        if (route >= 0) {
+            return route;
+        }
+    }
+    return node.multi >= 0 ? nodes[node.multi].route : -1;
+}
+
+const TopicRoute* TopicRouter::match(const char* topic, size_t length) const {
+    if (!routeCount) {
+        return nullptr;
+    }
+    const int route = matchFrom(0, topic, 0, length);
+    return route >= 0 ? &routes[route] : nullptr;
+}
+
+bool TopicRouter::dispatch(const char* topic, const char* payload, size_t length) const {
+    const TopicRoute* route = match(topic, strlen(topic));
+    if (!route) {
+        return false;
+    }
+    route->handler(route->slot, topic, payload, length);
+    return true;
+}
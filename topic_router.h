@@ -0,0 +1,63 @@
+#ifndef TOPIC_ROUTER_H
+#define TOPIC_ROUTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Maps MQTT topics to handlers. The routes are a static table; init()
+// turns their patterns into a trie of topic levels, with the literal
+// children of every node in one hash table keyed by (parent, level). A
+// lookup hashes each level of the topic once, so it costs O(topic length)
+// however many routes there are. Patterns may use the MQTT wildcards:
+// "+" for exactly one level and "#" as the last level for any number of
+// them, including none. Literal levels win over "+", "+" over "#".
+
+typedef void (*TopicHandler)(uint8_t slot, const char* topic, const char* payload, size_t length);
+
+struct TopicRoute {
+    const char* pattern;        // must outlive the router
+    TopicHandler handler;
+    uint8_t slot;               // entity index passed to the handler
+};
+
+class TopicRouter {
+public:
+    ~TopicRouter();
+    
+    // Builds the trie. Returns false for an invalid or duplicate pattern,
+    // or when out of memory; the router then matches nothing.
+    bool init(const TopicRoute* routes, size_t count);
+    
+    // Route for topic, nullptr if none matches
+    const TopicRoute* match(const char* topic, size_t length) const;
+    
+    // Calls the handler of the matching route; false if there is none
+    bool dispatch(const char* topic, const char* payload, size_t length) const;
+    
+    size_t getRouteCount() const { return routeCount; }
+    
+private:
+    struct Node {
+        const char* level;      // points into the route's pattern
+        uint32_t hash;
+        uint16_t levelLength;
+        uint16_t parent;
+        int16_t single = -1;    // "+" child
+        int16_t multi = -1;     // "#" child
+        int16_t route = -1;
+    };
+    
+    const TopicRoute* routes = nullptr;
+    size_t routeCount = 0;
+    Node* nodes = nullptr;
+    uint16_t nodeCount = 0;
+    uint16_t* table = nullptr;  // node index per slot, EMPTY when free
+    uint32_t tableMask = 0;
+    
+    void release();
+    int findChild(uint16_t parent, uint32_t hash, const char* level, size_t length) const;
+    int addChild(uint16_t parent, const char* level, size_t length);
+    int matchFrom(uint16_t node, const char* topic, size_t pos, size_t length) const;
+};
+
+#endif
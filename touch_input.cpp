@@ -0,0 +1,283 @@
+#include "touch_input.h"
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "driver/i2c.h"
+#include "esp_timer.h"
+#include "log_ring.h"
+#include "refresh_governor.h"
+
+static const char *TAG = "touch_input";
+
+#define FT3168_REG_TD_STATUS    0x02    // point count, followed by 6 bytes per point
+#define FT3168_POINT_STRIDE     6       // XH, XL, YH, YL, weight, area
+#define FT3168_BURST_LEN        (1 + FT3168_POINT_STRIDE + 4)  // up to P2_YL
+#define TOUCH_I2C_TIMEOUT_MS    20
+
+struct TouchSample {
+    int64_t timeUs = 0;
+    uint16_t x = 0;
+    uint16_t y = 0;
+    bool pressed = false;
+    TouchPoints points = {};
+};
+
+static portMUX_TYPE touchLock = portMUX_INITIALIZER_UNLOCKED;
+static TouchSample mailbox;
+static bool pressLatched = false;   // a press LVGL has not seen yet
+static TaskHandle_t readerTask = NULL;
+static SemaphoreHandle_t intSem = NULL;
+static TouchInputStats stats;
+
+static bool readSample(TouchSample *sample) {
+    uint8_t reg = FT3168_REG_TD_STATUS;
+    uint8_t buf[FT3168_BURST_LEN];
+
+    const int64_t start = esp_timer_get_time();
+    esp_err_t ret = i2c_master_write_read_device(TOUCH_HOST, I2C_ADDR_FT3168, &reg, 1, buf, sizeof(buf),
+                                                 pdMS_TO_TICKS(TOUCH_I2C_TIMEOUT_MS));
+    const uint32_t us = (uint32_t)(esp_timer_get_time() - start);
+    sample->timeUs = start;
+
+    portENTER_CRITICAL(&touchLock);
+    stats.reads++;
+    if (ret != ESP_OK) {
+        stats.readErrors++;
+    }
+    stats.burstUs = stats.burstUs ? (stats.burstUs * 7 + us) / 8 : us;
+    portEXIT_CRITICAL(&touchLock);
+
+    if (ret != ESP_OK) {
+        return false;
+    }
+
+    const uint8_t count = buf[0] & 0x0f;
+    sample->points.timeUs = start;
+    sample->points.count = count > TOUCH_MAX_POINTS ? TOUCH_MAX_POINTS : count;
+    sample->pressed = count != 0;
+
+    for (int i = 0; i < sample->points.count; i++) {
+        const uint8_t *p = &buf[1 + i * FT3168_POINT_STRIDE];
+        uint16_t y = (((uint16_t)p[0] & 0x0f) << 8) | (uint16_t)p[1];
+        uint16_t x = (((uint16_t)p[2] & 0x0f) << 8) | (uint16_t)p[3];
+        if (x > SCREEN_WIDTH) x = SCREEN_WIDTH;
+        if (y > SCREEN_HEIGHT) y = SCREEN_HEIGHT;
+        sample->points.point[i].x = x;
+        sample->points.point[i].y = SCREEN_HEIGHT - y;
+    }
+    if (sample->pressed) {
+        sample->x = sample->points.point[0].x;
+        sample->y = sample->points.point[0].y;
+    }
+    return true;
+}
+
+static void publishSample(const TouchSample &sample) {
+    portENTER_CRITICAL(&touchLock);
+    const bool newPress = sample.pressed && !mailbox.pressed;
+    // A release keeps the last position, LVGL reports it with the release
+    mailbox.timeUs = sample.timeUs;
+    mailbox.pressed = sample.pressed;
+    mailbox.points = sample.points;
+    if (sample.pressed) {
+        mailbox.x = sample.x;
+        mailbox.y = sample.y;
+    }
+    // Only the press edge; latching every pressed sample would show LVGL
+    // one more pressed read after the release
+    if (newPress) {
+        pressLatched = true;
+    }
+    portEXIT_CRITICAL(&touchLock);
+
+    // LVGL reads touch slowly while idle
+    if (newPress) {
+        refreshGovernorWake();
+    }
+}
+
+#if TOUCH_INPUT_TASK
+#if EXAMPLE_PIN_NUM_TOUCH_INT >= 0
+static void touchIntIsr(void *arg) {
+    BaseType_t taskWoken = pdFALSE;
+    xSemaphoreGiveFromISR(intSem, &taskWoken);
+    if (taskWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+#endif
+
+static void setPollStat(uint32_t pollMs) {
+    portENTER_CRITICAL(&touchLock);
+    stats.pollMs = pollMs;
+    portEXIT_CRITICAL(&touchLock);
+}
+
+static void touchTask(void *arg) {
+    LOG_I(TAG, "Starting touch task");
+    uint32_t pollMs = TOUCH_POLL_ACTIVE_MS;
+    int64_t lastTouchUs = esp_timer_get_time();
+    bool touched = false;
+
+    while (1) {
+        TouchSample sample;
+        if (readSample(&sample)) {
+            publishSample(sample);
+            touched = sample.pressed;
+        }
+        if (touched) {
+            lastTouchUs = esp_timer_get_time();
+        }
+
+#if EXAMPLE_PIN_NUM_TOUCH_INT >= 0
+        // INT marks new reports but not the release, so keep polling until the finger is gone
+        if (touched) {
+            pollMs = TOUCH_POLL_ACTIVE_MS;
+            setPollStat(pollMs);
+            xSemaphoreTake(intSem, pdMS_TO_TICKS(pollMs));
+        } else {
+            setPollStat(0);
+            xSemaphoreTake(intSem, portMAX_DELAY);
+            portENTER_CRITICAL(&touchLock);
+            stats.intWakeups++;
+            portEXIT_CRITICAL(&touchLock);
+        }
+#else
+        if (touched) {
+            pollMs = TOUCH_POLL_ACTIVE_MS;
+        } else if (esp_timer_get_time() - lastTouchUs >= TOUCH_IDLE_AFTER_MS * 1000LL) {
+            pollMs = pollMs * 2 > TOUCH_POLL_IDLE_MS ? TOUCH_POLL_IDLE_MS : pollMs * 2;
+        }
+        setPollStat(pollMs);
+        vTaskDelay(pdMS_TO_TICKS(pollMs));
+#endif
+    }
+}
+
+static bool startReaderTask() {
+    intSem = xSemaphoreCreateBinary();
+    if (!intSem) {
+        LOG_E(TAG, "Failed to create touch semaphore!");
+        return false;
+    }
+
+#if EXAMPLE_PIN_NUM_TOUCH_INT >= 0
+    gpio_config_t io_conf = {};
+    io_conf.pin_bit_mask = 1ULL << EXAMPLE_PIN_NUM_TOUCH_INT;
+    io_conf.mode = GPIO_MODE_INPUT;
+    io_conf.pull_up_en = GPIO_PULLUP_ENABLE;
+    io_conf.intr_type = GPIO_INTR_NEGEDGE;
+    ESP_ERROR_CHECK(gpio_config(&io_conf));
+
+    // The ISR service may already be installed by another driver
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        LOG_E(TAG, "Touch ISR service install failed: %d", ret);
+        return false;
+    }
+    ESP_ERROR_CHECK(gpio_isr_handler_add((gpio_num_t)EXAMPLE_PIN_NUM_TOUCH_INT, touchIntIsr, NULL));
+    LOG_I(TAG, "Touch reads triggered by INT on GPIO %d", EXAMPLE_PIN_NUM_TOUCH_INT);
+#else
+    LOG_I(TAG, "Touch polled every %d-%d ms", TOUCH_POLL_ACTIVE_MS, TOUCH_POLL_IDLE_MS);
+#endif
+
+    if (xTaskCreatePinnedToCore(touchTask, "touch", TOUCH_TASK_STACK_SIZE, NULL,
+                                TOUCH_TASK_PRIORITY, &readerTask, TOUCH_TASK_CORE) != pdPASS) {
+        LOG_E(TAG, "Failed to create touch task!");
+        readerTask = NULL;
+        return false;
+    }
+    return true;
+}
+#endif
+
+bool touchInputInit() {
+    i2c_config_t i2c_conf = {};
+    i2c_conf.mode = I2C_MODE_MASTER;
+    i2c_conf.sda_io_num = EXAMPLE_PIN_NUM_TOUCH_SDA;
+    i2c_conf.sda_pullup_en = GPIO_PULLUP_ENABLE;
+    i2c_conf.scl_io_num = EXAMPLE_PIN_NUM_TOUCH_SCL;
+    i2c_conf.scl_pullup_en = GPIO_PULLUP_ENABLE;
+    i2c_conf.master.clk_speed = TOUCH_I2C_FREQ_HZ;
+
+    ESP_ERROR_CHECK(i2c_param_config(TOUCH_HOST, &i2c_conf));
+    ESP_ERROR_CHECK(i2c_driver_install(TOUCH_HOST, i2c_conf.mode, 0, 0, 0));
+
+    uint8_t data = 0x00;
+    esp_err_t ret = i2c_master_write_to_device(TOUCH_HOST, I2C_ADDR_FT3168, &data, 1, 1000);
+    if (ret != ESP_OK) {
+        LOG_E(TAG, "Touch controller init failed: %d", ret);
+        return false;
+    }
+    LOG_I(TAG, "Touch controller initialized");
+
+#if TOUCH_INPUT_TASK
+    // Without the task, touchInputRead() reads the controller itself
+    if (!startReaderTask()) {
+        LOG_W(TAG, "Touch task not started, reading from the LVGL task");
+    }
+#endif
+    return true;
+}
+
+int64_t touchInputRead(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
+    const int64_t start = esp_timer_get_time();
+    TouchSample sample;
+
+    if (readerTask) {
+        portENTER_CRITICAL(&touchLock);
+        sample = mailbox;
+        // A tap that came and went between two reads still shows up as one press
+        if (pressLatched) {
+            sample.pressed = true;
+            pressLatched = false;
+        }
+        portEXIT_CRITICAL(&touchLock);
+    } else if (readSample(&sample)) {
+        publishSample(sample);
+        sample = mailbox;
+    } else {
+        sample = mailbox;
+        sample.timeUs = start;
+        sample.pressed = false;
+    }
+
+    data->state = sample.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->point.x = sample.x;
+    data->point.y = sample.y;
+
+    const uint32_t us = (uint32_t)(esp_timer_get_time() - start);
+    portENTER_CRITICAL(&touchLock);
+    stats.readCbUs = stats.readCbUs ? (stats.readCbUs * 7 + us) / 8 : us;
+    if (us > stats.readCbMaxUs) {
+        stats.readCbMaxUs = us;
+    }
+    portEXIT_CRITICAL(&touchLock);
+    return sample.timeUs;
+}
+
+bool touchInputGetPoint(uint16_t *x, uint16_t *y) {
+    portENTER_CRITICAL(&touchLock);
+    const TouchSample sample = mailbox;
+    portEXIT_CRITICAL(&touchLock);
+
+    *x = sample.x;
+    *y = sample.y;
+    return sample.pressed;
+}
+
+bool touchInputGetPoints(TouchPoints *points) {
+    portENTER_CRITICAL(&touchLock);
+    *points = mailbox.points;
+    portEXIT_CRITICAL(&touchLock);
+    return points->count != 0;
+}
+
+TouchInputStats getTouchInputStats() {
+    portENTER_CRITICAL(&touchLock);
+    TouchInputStats copy = stats;
+    portEXIT_CRITICAL(&touchLock);
+    return copy;
+}
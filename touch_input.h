@@ -0,0 +1,61 @@
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// FT3168 touch input. A task reads status and both touch points in one I2C
+// burst and leaves the newest sample in a mailbox; LVGL's read callback
+// only copies it out and never touches the bus.
+//
+// With EXAMPLE_PIN_NUM_TOUCH_INT wired the task sleeps until the
+// controller pulls INT low. Without it the task polls, every
+// TOUCH_POLL_ACTIVE_MS while a finger is down and backing off to
+// TOUCH_POLL_IDLE_MS once the panel has been untouched for
+// TOUCH_IDLE_AFTER_MS.
+
+#define TOUCH_MAX_POINTS 2
+
+// All points of one controller report, in panel coordinates
+struct TouchPoints {
+    int64_t timeUs;         // when the controller was read (esp_timer time)
+    uint8_t count;          // 0 when released
+    struct {
+        uint16_t x;
+        uint16_t y;
+    } point[TOUCH_MAX_POINTS];
+};
+
+// readCbUs and readCbMaxUs are how long LVGL's render loop stalled on
+// touch input; they go out as touch_cb_us and touch_cb_max_us on
+// DIAGNOSTICS_TOPIC. To compare, build once with TOUCH_INPUT_TASK 0
+// (I2C inside the read callback) and once with 1, drag on a slider for
+// a minute with each, and read those two next to frame_max_ms.
+struct TouchInputStats {
+    uint32_t reads = 0;         // I2C bursts
+    uint32_t readErrors = 0;
+    uint32_t intWakeups = 0;    // reads started by the INT line
+    uint32_t burstUs = 0;       // duration of one burst, running average
+    uint32_t pollMs = 0;        // current polling interval, 0 while waiting on INT
+    uint32_t readCbUs = 0;      // time touchInputRead() held up the LVGL task, running average
+    uint32_t readCbMaxUs = 0;
+};
+
+// Sets up the I2C bus and checks that the controller answers. Starts the
+// reader task when TOUCH_INPUT_TASK is set. Returns false if the
+// controller does not respond.
+bool touchInputInit();
+
+// LVGL indev read callback, reports the first point. Returns when the sample was read from the
+// controller (esp_timer time).
+int64_t touchInputRead(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
+
+// Newest sample, in panel coordinates. Returns false when not touched.
+bool touchInputGetPoint(uint16_t *x, uint16_t *y);
+
+// Newest report with every point. Returns false when not touched.
+bool touchInputGetPoints(TouchPoints *points);
+
+TouchInputStats getTouchInputStats();
+
+#endif
@@ -0,0 +1,30 @@
+#include "ui_queue.h"
+
+static_assert((UI_QUEUE_DEPTH & (UI_QUEUE_DEPTH - 1)) == 0, "UI_QUEUE_DEPTH must be a power of two");
+
+UiQueue uiQueue;
+
+bool UiQueue::push(const UiUpdate& msg) {
+    const uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) == UI_QUEUE_DEPTH) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    
+    slots[h & (UI_QUEUE_DEPTH - 1)] = msg;
+    // Publish the slot only after its content is written
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+bool UiQueue::pop(UiUpdate& msg) {
+    const uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) {
+        return false;
+    }
+    
+    msg = slots[t & (UI_QUEUE_DEPTH - 1)];
+    // Hand the slot back only after it has been copied out
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
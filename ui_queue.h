@@ -0,0 +1,64 @@
+#ifndef UI_QUEUE_H
+#define UI_QUEUE_H
+
+#include <atomic>
+#include <stdint.h>
+#include "config.h"
+
+// UI updates from the Arduino loop task (MQTT callbacks) to the LVGL task.
+// LVGL objects are only touched on the LVGL task: the producer pushes a
+// copy of the new state, the LVGL task drains the queue once per refresh
+// period and keeps only the newest message of each type before it
+// touches any widget.
+
+enum UiUpdateType : uint8_t {
+    UI_UPDATE_LIGHT,
+    UI_UPDATE_HVAC,
+    UI_UPDATE_SHOW_SCREEN,
+    UI_UPDATE_TYPE_COUNT
+};
+
+struct UiLightSnapshot {
+    bool isOn;
+    bool available;
+    int brightness;
+    int colorTemp;
+};
+
+struct UiHvacSnapshot {
+    bool isOn;
+    bool available;
+    float currentTemp;
+    float targetTemp;
+    char mode[12];      // fits every Home Assistant hvac_mode
+};
+
+struct UiUpdate {
+    UiUpdateType type;
+    union {
+        UiLightSnapshot light;
+        UiHvacSnapshot hvac;
+        ScreenType screen;
+    };
+};
+
+// Bounded single-producer/single-consumer ring. push() must only be called
+// from one task and pop() from one other task; neither blocks.
+class UiQueue {
+public:
+    // Returns false and counts a drop if the queue is full
+    bool push(const UiUpdate& msg);
+    bool pop(UiUpdate& msg);
+    
+    uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+    
+private:
+    UiUpdate slots[UI_QUEUE_DEPTH];
+    std::atomic<uint32_t> head{0};      // written by the producer only
+    std::atomic<uint32_t> tail{0};      // written by the consumer only
+    std::atomic<uint32_t> dropped{0};
+};
+
+extern UiQueue uiQueue;
+
+#endif
@@ -0,0 +1,55 @@
+#include "ui_styles.h"
+
+extern const lv_font_t montserrat_96;
+
+UiStyles uiStyles;
+
+static void initText(lv_style_t* style, lv_color_t color, const lv_font_t* font) {
+    lv_style_init(style);
+    lv_style_set_text_color(style, color);
+    lv_style_set_text_font(style, font);
+}
+
+void uiStylesInit() {
+    static bool initialized = false;
+    if (initialized) return;
+    initialized = true;
+    
+    lv_style_init(&uiStyles.screen);
+    lv_style_set_bg_color(&uiStyles.screen, lv_color_black());
+    lv_style_set_bg_opa(&uiStyles.screen, LV_OPA_COVER);
+    lv_style_set_border_width(&uiStyles.screen, 0);
+    lv_style_set_pad_all(&uiStyles.screen, 0);
+    
+    initText(&uiStyles.textSmall, lv_color_white(), &lv_font_montserrat_22);
+    initText(&uiStyles.textLarge, lv_color_white(), &lv_font_montserrat_48);
+    initText(&uiStyles.textDigits, lv_color_white(), &montserrat_96);
+    
+    lv_style_init(&uiStyles.barMain);
+    lv_style_set_bg_color(&uiStyles.barMain, lv_color_hex(0x333333));
+    lv_style_set_border_width(&uiStyles.barMain, 0);
+    
+    lv_style_init(&uiStyles.barIndicator);
+    lv_style_set_bg_color(&uiStyles.barIndicator, lv_color_hex(0xFF9500));
+    
+    // Text properties are inherited, the button label needs no style of its own
+    initText(&uiStyles.buttonMode, lv_color_white(), &lv_font_montserrat_22);
+    lv_style_set_bg_color(&uiStyles.buttonMode, lv_color_hex(0x333333));
+    
+    lv_style_init(&uiStyles.buttonOffChecked);
+    lv_style_set_bg_color(&uiStyles.buttonOffChecked, lv_color_hex(0x666666));
+    
+    lv_style_init(&uiStyles.buttonCoolChecked);
+    lv_style_set_bg_color(&uiStyles.buttonCoolChecked, lv_color_hex(COLOR_PRIMARY));
+    
+    initText(&uiStyles.buttonStep, lv_color_white(), &montserrat_96);
+    lv_style_set_bg_color(&uiStyles.buttonStep, lv_color_hex(0x404040));
+    
+    initText(&uiStyles.tile, lv_color_hex(0xAAAAAA), &lv_font_montserrat_22);
+    lv_style_set_bg_color(&uiStyles.tile, lv_color_hex(0x222222));
+    
+    initText(&uiStyles.overlay, lv_color_hex(COLOR_SUCCESS), &lv_font_montserrat_22);
+    lv_style_set_bg_color(&uiStyles.overlay, lv_color_black());
+    lv_style_set_bg_opa(&uiStyles.overlay, LV_OPA_60);
+    lv_style_set_pad_all(&uiStyles.overlay, 4);
+}
@@ -0,0 +1,32 @@
+#ifndef UI_STYLES_H
+#define UI_STYLES_H
+
+#include <lvgl.h>
+#include "config.h"
+
+// Styles shared by every widget of the UI. Each one is initialized once in
+// static RAM; widgets add them with lv_obj_add_style() instead of setting
+// local style properties, which LVGL keeps on its heap per object. State
+// dependent looks (the active HVAC mode) hang off LV_STATE_CHECKED, so a
+// state message that changes nothing restyles and redraws nothing.
+struct UiStyles {
+    lv_style_t screen;          // black, no border or padding
+    lv_style_t textSmall;       // white, montserrat_22
+    lv_style_t textLarge;       // white, montserrat_48
+    lv_style_t textDigits;      // white, montserrat_96
+    lv_style_t barMain;         // dark track
+    lv_style_t barIndicator;    // orange fill
+    lv_style_t buttonMode;      // OFF and COOL, dark while not selected
+    lv_style_t buttonOffChecked;
+    lv_style_t buttonCoolChecked;
+    lv_style_t buttonStep;      // the full height + and - buttons
+    lv_style_t tile;            // overview tile, grey text for title and detail
+    lv_style_t overlay;         // perf monitor readout over a dimmed background
+};
+
+extern UiStyles uiStyles;
+
+// Call once after lv_init(), before any widget uses the styles
+void uiStylesInit();
+
+#endif